@@ -7,6 +7,8 @@
 
 // local
 #include "../layouts/importer.h"
+#include "../tools/filewatcher.h"
+#include "../tools/profiler.h"
 
 // Qt
 #include <QDebug>
@@ -15,12 +17,14 @@
 #include <QDirIterator>
 #include <QMessageBox>
 #include <QProcess>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QScopedPointer>
 #include <QTemporaryDir>
 #include <QTimer>
 #include <QLatin1String>
 
 // KDE
-#include <KDirWatch>
 #include <KLocalizedString>
 #include <KMessageBox>
 #include <KNotification>
@@ -29,6 +33,7 @@
 #include <KArchive/KZip>
 #include <KArchive/KArchiveEntry>
 #include <KArchive/KArchiveDirectory>
+#include <KArchive/KArchiveFile>
 #include <KNewStuff3/KNS3/QtQuickDialogWrapper>
 
 namespace Latte {
@@ -37,6 +42,8 @@ namespace Indicator {
 Factory::Factory(QObject *parent)
     : QObject(parent)
 {
+    Profiler::Scope profilerScope("startup", "indicatorsDiscovery");
+
     m_parentWidget = new QWidget();
 
     m_mainPaths = Latte::Layouts::Importer::standardPaths();
@@ -46,28 +53,11 @@ Factory::Factory(QObject *parent)
         discoverNewIndicators(m_mainPaths[i]);
     }
 
-    //! track paths for changes
+    //! track paths for changes, consider indicator addition
     for(const auto &dir : m_mainPaths) {
-        KDirWatch::self()->addDir(dir);
+        connect(FileWatcher::self()->addDir(dir), &WatchedPath::changed, this, &Factory::discoverNewIndicators);
     }
 
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ & ](const QString & path) {
-        if (m_indicatorsPaths.contains(path)) {
-            //! indicator updated
-            reload(path);
-        } else if (m_mainPaths.contains(path)){
-            //! consider indicator addition
-            discoverNewIndicators(path);
-        }
-    });
-
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, [ & ](const QString & path) {
-        if (m_indicatorsPaths.contains(path)) {
-            //! indicator removed
-            removeIndicatorRecords(path);
-        }
-    });
-
     qDebug() << m_plugins["org.kde.latte.default"].name();
 }
 
@@ -122,6 +112,8 @@ void Factory::reload(const QString &indicatorPath)
 
             if (metadataAreValid(metadata)) {
                 pluginChangedId = metadata.pluginId();
+                invalidateComponents(indicatorPath);
+
                 QString uiFile = indicatorPath + "/package/" + metadata.value("X-Latte-MainScript");
 
                 if (!m_plugins.contains(metadata.pluginId())) {
@@ -199,7 +191,12 @@ void Factory::discoverNewIndicators(const QString &main)
 
         if (!m_indicatorsPaths.contains(iPath)) {
             m_indicatorsPaths << iPath;
-            KDirWatch::self()->addDir(iPath);
+
+            //! indicator updated or removed
+            WatchedPath *indicatorDir = FileWatcher::self()->addDir(iPath);
+            connect(indicatorDir, &WatchedPath::changed, this, &Factory::reload);
+            connect(indicatorDir, &WatchedPath::deleted, this, &Factory::removeIndicatorRecords);
+
             reload(iPath);
         }
     }
@@ -219,8 +216,9 @@ void Factory::removeIndicatorRecords(const QString &path)
         m_customLocalPluginIds.removeAll(pluginId);
 
         m_indicatorsPaths.removeAll(path);
+        invalidateComponents(path);
 
-        KDirWatch::self()->removeDir(path);
+        FileWatcher::self()->removePath(path);
 
         //! delay informing the removal in case it is just an update
         QTimer::singleShot(1000, [this, pluginId]() {
@@ -260,6 +258,79 @@ QString Factory::uiPath(QString pluginName) const
     return m_pluginUiPaths[pluginName];
 }
 
+QQmlComponent *Factory::acquireComponent(QQmlEngine *engine, const QString &file)
+{
+    if (!engine || file.isEmpty()) {
+        return nullptr;
+    }
+
+    //! KQuickAddons::QuickViewSharedEngine provides the same engine to all views
+    //! but in case that ever changes components must not be shared between engines
+    if (m_engine && m_engine != engine) {
+        qWarning() << "Indicator factory: views are not sharing the same qml engine, indicator components will not be shared...";
+        QQmlComponent *component = new QQmlComponent(engine, file, this);
+        m_componentUsers[component] = 1;
+        return component;
+    }
+
+    m_engine = engine;
+
+    QQmlComponent *component = m_components.value(file, nullptr);
+
+    if (!component) {
+        component = new QQmlComponent(engine, file, this);
+        m_components[file] = component;
+    }
+
+    m_componentUsers[component] = m_componentUsers.value(component, 0) + 1;
+
+    return component;
+}
+
+void Factory::releaseComponent(QQmlComponent *component)
+{
+    if (!component || !m_componentUsers.contains(component)) {
+        return;
+    }
+
+    m_componentUsers[component] = m_componentUsers[component] - 1;
+
+    //! unused components are kept cached in order to be reused from recreated views,
+    //! invalidated ones are released when their last user is gone
+    bool isCached = !m_components.key(component).isEmpty();
+
+    if (m_componentUsers[component] <= 0 && !isCached) {
+        m_componentUsers.remove(component);
+        component->deleteLater();
+    }
+}
+
+void Factory::invalidateComponents(const QString &indicatorPath)
+{
+    bool invalidated{false};
+    const QString prefix = indicatorPath + "/";
+
+    for (const auto &file : m_components.keys()) {
+        if (!file.startsWith(prefix)) {
+            continue;
+        }
+
+        QQmlComponent *component = m_components.take(file);
+        invalidated = true;
+
+        if (m_componentUsers.value(component, 0) <= 0) {
+            m_componentUsers.remove(component);
+            component->deleteLater();
+        }
+    }
+
+    //! indicator files were updated, the engine must compile them again.
+    //! This is done once for all views instead of once per view reload
+    if (invalidated && m_engine) {
+        m_engine->clearComponentCache();
+    }
+}
+
 QString Factory::metadataFileAbsolutePath(const QString &directoryPath)
 {
     QString metadataFile = directoryPath + "/metadata.json";
@@ -292,54 +363,67 @@ Latte::ImportExport::State Factory::importIndicatorFile(QString compressedFile)
         notification->sendEvent();
     };
 
-    KArchive *archive;
-
-    KZip *zipArchive = new KZip(compressedFile);
-    zipArchive->open(QIODevice::ReadOnly);
-
-    //! if the file isnt a zip archive
-    if (!zipArchive->isOpen()) {
-        delete zipArchive;
+    QScopedPointer<KArchive> archive(new KZip(compressedFile));
+    archive->open(QIODevice::ReadOnly);
 
-        KTar *tarArchive = new KTar(compressedFile, QStringLiteral("application/x-tar"));
-        tarArchive->open(QIODevice::ReadOnly);
+    //! if the file isnt a zip archive, compression is identified from file contents
+    if (!archive->isOpen()) {
+        archive.reset(new KTar(compressedFile));
+        archive->open(QIODevice::ReadOnly);
 
-        if (!tarArchive->isOpen()) {
-            delete tarArchive;
+        if (!archive->isOpen()) {
             showNotificationError();
             return Latte::ImportExport::FailedState;
-        } else {
-            archive = tarArchive;
         }
-    } else {
-        archive = zipArchive;
     }
 
-    QTemporaryDir archiveTempDir;
-    archive->directory()->copyTo(archiveTempDir.path());
+    auto metadataEntry = [](const KArchiveDirectory *dir) -> const KArchiveFile * {
+        for (const auto &name : {QStringLiteral("metadata.json"), QStringLiteral("metadata.desktop")}) {
+            if (const KArchiveFile *file = dir->file(name)) {
+                return file;
+            }
+        }
+
+        return nullptr;
+    };
 
-    //metadata file
-    QString packagePath = archiveTempDir.path();
-    QString metadataFile = metadataFileAbsolutePath(archiveTempDir.path());
+    //! the package can be found at the archive root or at its first level directories
+    const KArchiveDirectory *packageDir = archive->directory();
+    const KArchiveFile *metadataFile = metadataEntry(packageDir);
 
-    if (!QFileInfo(metadataFile).exists()){
-        QDirIterator iter(archiveTempDir.path(), QDir::Dirs | QDir::NoDotAndDotDot);
+    if (!metadataFile) {
+        const KArchiveDirectory *rootDir = archive->directory();
 
-        while(iter.hasNext() ) {
-            QString currentPath = iter.next();
+        for (const auto &name : rootDir->entries()) {
+            const KArchiveEntry *entry = rootDir->entry(name);
 
-            QString tempMetadata = metadataFileAbsolutePath(currentPath);
+            if (entry && entry->isDirectory()) {
+                const KArchiveDirectory *dir = static_cast<const KArchiveDirectory *>(entry);
 
-            if (QFileInfo(tempMetadata).exists()) {
-                metadataFile = tempMetadata;
-                packagePath = currentPath;
+                if (const KArchiveFile *file = metadataEntry(dir)) {
+                    packageDir = dir;
+                    metadataFile = file;
+                }
             }
         }
     }
 
-    KPluginMetaData metadata = KPluginMetaData(metadataFile);
+    if (!metadataFile) {
+        showNotificationError();
+        return Latte::ImportExport::FailedState;
+    }
+
+    //! metadata are validated before the package is extracted
+    QTemporaryDir metadataTempDir;
+    metadataFile->copyTo(metadataTempDir.path());
+
+    KPluginMetaData metadata = KPluginMetaData(metadataTempDir.path() + "/" + metadataFile->name());
 
     if (metadataAreValid(metadata)) {
+        QTemporaryDir archiveTempDir;
+        QString packagePath = archiveTempDir.path() + "/package";
+        packageDir->copyTo(packagePath);
+
         QStringList standardPaths = Latte::Layouts::Importer::standardPaths();
         QString installPath = standardPaths[0] + "/latte/indicators/" + metadata.pluginId();
 
@@ -12,9 +12,12 @@
 // Qt
 #include <QHash>
 #include <QObject>
+#include <QPointer>
 #include <QWidget>
 
 class KPluginMetaData;
+class QQmlComponent;
+class QQmlEngine;
 
 namespace Latte {
 namespace Indicator {
@@ -42,6 +45,11 @@ public:
 
     QString uiPath(QString pluginName) const;
 
+    //! all views share the same qml engine, so indicator components are compiled
+    //! only once and are shared between all views and their clones
+    QQmlComponent *acquireComponent(QQmlEngine *engine, const QString &file);
+    void releaseComponent(QQmlComponent *component);
+
     static QString metadataFileAbsolutePath(const QString &directoryPath);
 
     //! metadata record
@@ -60,6 +68,7 @@ private:
 
     void removeIndicatorRecords(const QString &path);
     void discoverNewIndicators(const QString &main);
+    void invalidateComponents(const QString &indicatorPath);
 
 private:
     QHash<QString, KPluginMetaData> m_plugins;
@@ -74,6 +83,12 @@ private:
     QStringList m_indicatorsPaths;
 
     QWidget *m_parentWidget;
+
+    //! shared indicator components, file path -> component
+    QHash<QString, QQmlComponent *> m_components;
+    //! component -> number of indicators using it
+    QHash<QQmlComponent *, int> m_componentUsers;
+    QPointer<QQmlEngine> m_engine;
 };
 
 }
@@ -33,6 +33,7 @@
 #include "plasma/extended/theme.h"
 #include "settings/universalsettings.h"
 #include "templates/templatesmanager.h"
+#include "tools/profiler.h"
 #include "view/originalview.h"
 #include "view/view.h"
 #include "view/settings/viewsettingsfactory.h"
@@ -223,8 +224,17 @@ void Corona::load()
 
         disconnect(m_activitiesConsumer, &KActivities::Consumer::serviceStatusChanged, this, &Corona::load);
 
-        m_templatesManager->init();
-        m_layoutsManager->init();
+        Profiler::Scope profilerScope("startup", "load");
+
+        {
+            Profiler::Scope templatesScope("startup", "templatesInit");
+            m_templatesManager->init();
+        }
+
+        {
+            Profiler::Scope layoutsScope("startup", "layoutsInit");
+            m_layoutsManager->init();
+        }
 
         connect(this, &Corona::availableScreenRectChangedFrom, this, &Plasma::Corona::availableScreenRectChanged, Qt::UniqueConnection);
         connect(this, &Corona::availableScreenRegionChangedFrom, this, &Plasma::Corona::availableScreenRegionChanged, Qt::UniqueConnection);
@@ -265,7 +275,10 @@ void Corona::load()
             m_universalSettings->setLayoutsMemoryUsage(MemoryUsage::SingleLayout);
         }
 
-        m_layoutsManager->loadLayoutOnStartup(loadLayoutName);
+        {
+            Profiler::Scope layoutOnStartupScope("startup", "loadLayoutOnStartup");
+            m_layoutsManager->loadLayoutOnStartup(loadLayoutName);
+        }
 
         //! load screens signals such screenGeometryChanged in order to support
         //! plasmoid.screenGeometry properly
@@ -1113,6 +1126,21 @@ void Corona::setAutostart(const bool &enabled)
     m_universalSettings->setAutostart(enabled);
 }
 
+void Corona::setProfilerEnabled(const bool &enabled)
+{
+    if (enabled && !Profiler::self()->isEnabled()) {
+        //! a new recording starts
+        Profiler::self()->clear();
+    }
+
+    Profiler::self()->setEnabled(enabled);
+}
+
+QString Corona::profilerTrace() const
+{
+    return QString::fromUtf8(Profiler::self()->trace());
+}
+
 void Corona::switchToLayout(QString layout)
 {
     if ((layout.startsWith("file:/") || layout.startsWith("/")) && layout.endsWith(".layout.latte")) {
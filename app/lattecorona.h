@@ -151,12 +151,16 @@ public:
     QStringList contextMenuData(const uint &containmentId);
     QStringList viewTemplatesData();
 
+    //! profiler trace in Chrome trace format
+    QString profilerTrace() const;
+
 public slots:
     void aboutApplication();
     void activateLauncherMenu();
     void loadDefaultLayout() override;
 
     void setAutostart(const bool &enabled);
+    void setProfilerEnabled(const bool &enabled);
 
     void addView(const uint &containmentId, const QString &templateId);
     void duplicateView(const uint &containmentId);
@@ -18,13 +18,17 @@
 #include "../tools/commontools.h"
 
 // Qt
+#include <QBuffer>
 #include <QFile>
 #include <QLatin1String>
+#include <QRunnable>
 
 // KDE
+#include <KArchive/KCompressionDevice>
 #include <KArchive/KTar>
 #include <KArchive/KArchiveEntry>
 #include <KArchive/KArchiveDirectory>
+#include <KArchive/KArchiveFile>
 #include <KConfigGroup>
 #include <KLocalizedString>
 #include <KNotification>
@@ -44,11 +48,15 @@ Importer::Importer(QObject *parent)
 {
     m_manager = qobject_cast<Layouts::Manager *>(parent);
 
+    m_exportThreadPool.setMaxThreadCount(1);
+
     qDebug() << " IMPORTER, STORAGE TEMP DIR ::: " << m_storageTmpDir.path();
 }
 
 Importer::~Importer()
 {
+    //! background exports are using the importer in order to report their progress
+    m_exportThreadPool.waitForDone();
 }
 
 bool Importer::updateOldConfiguration()
@@ -377,46 +385,122 @@ bool Importer::importOldConfiguration(QString oldConfigPath, QString newName)
     return true;
 }
 
-bool Importer::exportFullConfiguration(QString file)
+QList<QPair<QString, QString>> Importer::fullConfigurationEntries() const
 {
-    if (QFile::exists(file) && !QFile::remove(file)) {
-        return false;
-    }
+    QList<QPair<QString, QString>> entries;
 
-    KTar archive(file, QStringLiteral("application/x-tar"));
-
-    if (!archive.open(QIODevice::WriteOnly)) {
-        return false;
-    }
-
-    archive.addLocalFile(QString(Latte::configPath() + "/lattedockrc"), QStringLiteral("lattedockrc"));
+    entries << qMakePair(QString(Latte::configPath() + "/lattedockrc"), QStringLiteral("lattedockrc"));
 
     for(const auto &layoutName : availableLayouts()) {
-        archive.addLocalFile(layoutUserFilePath(layoutName), QString("latte/" + layoutName + ".layout.latte"));
+        entries << qMakePair(layoutUserFilePath(layoutName), QString("latte/" + layoutName + ".layout.latte"));
     }
 
     //! custom templates
     QDir templatesDir(Latte::configPath() + "/latte/templates");
     QStringList filters;
     filters.append(QString("*.layout.latte"));
+    filters.append(QString("*.view.latte"));
     QStringList templates = templatesDir.entryList(filters, QDir::Files | QDir::Hidden | QDir::NoSymLinks);
 
     for (int i=0; i<templates.count(); ++i) {
         QString templatePath = templatesDir.path() + "/" + templates[i];
-        archive.addLocalFile(templatePath, QString("latte/templates/" + templates[i]));
+        entries << qMakePair(templatePath, QString("latte/templates/" + templates[i]));
     }
 
-    filters.clear();
-    filters.append(QString("*.view.latte"));
-    templates = templatesDir.entryList(filters, QDir::Files | QDir::Hidden | QDir::NoSymLinks);
+    return entries;
+}
 
-    for (int i=0; i<templates.count(); ++i) {
-        QString templatePath = templatesDir.path() + "/" + templates[i];
-        archive.addLocalFile(templatePath, QString("latte/templates/" + templates[i]));
+bool Importer::writeArchive(const QString &file,
+                            ArchiveCompression compression,
+                            const QList<QPair<QString, QString>> &entries,
+                            std::function<void(int)> progress)
+{
+    if (QFile::exists(file) && !QFile::remove(file)) {
+        return false;
+    }
+
+    QString mimetype = QStringLiteral("application/x-tar");
+
+    if (compression == XzCompression) {
+        mimetype = QStringLiteral("application/x-xz-compressed-tar");
+    } else if (compression == ZstdCompression) {
+        mimetype = QStringLiteral("application/x-zstd-compressed-tar");
+    }
+
+    //! files are streamed through the compression device, they are never loaded as a whole
+    KTar archive(file, mimetype);
+
+    if (!archive.open(QIODevice::WriteOnly)) {
+        return false;
     }
 
-    archive.close();
+    for (int i=0; i<entries.count(); ++i) {
+        if (!archive.addLocalFile(entries[i].first, entries[i].second)) {
+            qDebug() << "Full configuration export, file could not be added :: " << entries[i].first;
+        }
+
+        if (progress) {
+            progress(i+1);
+        }
+    }
 
+    return archive.close();
+}
+
+bool Importer::exportFullConfiguration(QString file, ArchiveCompression compression)
+{
+    return writeArchive(file, compression, fullConfigurationEntries());
+}
+
+void Importer::exportFullConfigurationInBackground(const QString &file, ArchiveCompression compression)
+{
+    if (!m_isExportingFullConfiguration.testAndSetOrdered(0, 1)) {
+        emit fullConfigurationExportFinished(file, false);
+        return;
+    }
+
+    //! files are collected in gui thread because layouts can be added or removed from it
+    QList<QPair<QString, QString>> entries = fullConfigurationEntries();
+    int total = entries.count();
+
+    emit fullConfigurationExportProgress(file, 0, total);
+
+    m_exportThreadPool.start(QRunnable::create([this, file, compression, entries, total]() {
+        bool succeeded = writeArchive(file, compression, entries, [this, file, total](int exported) {
+            QMetaObject::invokeMethod(this, [this, file, exported, total]() {
+                emit fullConfigurationExportProgress(file, exported, total);
+            }, Qt::QueuedConnection);
+        });
+
+        QMetaObject::invokeMethod(this, [this, file, succeeded]() {
+            m_isExportingFullConfiguration.storeRelease(0);
+            emit fullConfigurationExportFinished(file, succeeded);
+        }, Qt::QueuedConnection);
+    }));
+}
+
+bool Importer::isExportingFullConfiguration() const
+{
+    return m_isExportingFullConfiguration.loadAcquire() == 1;
+}
+
+bool Importer::isCompressionSupported(ArchiveCompression compression)
+{
+    if (compression == NoCompression) {
+        return true;
+    }
+
+    KCompressionDevice::CompressionType type = (compression == XzCompression) ? KCompressionDevice::Xz : KCompressionDevice::Zstd;
+
+    //! compression devices of filters that KArchive was not built with can not be opened
+    QBuffer buffer;
+    KCompressionDevice device(&buffer, false, type);
+
+    if (!device.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    device.close();
     return true;
 }
 
@@ -440,7 +524,8 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
         return Importer::UnknownFileType;
     }
 
-    KTar archive(file, QStringLiteral("application/x-tar"));
+    //! compression is identified from file contents
+    KTar archive(file);
     archive.open(QIODevice::ReadOnly);
 
     //! if the file isnt a tar archive
@@ -457,8 +542,16 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     bool version2LatteDir = false;
     bool version2layout = false;
 
-    archive.directory()->copyTo(archiveTempDir.path());
+    //! only the files that identify the version are extracted
+    const KArchiveDirectory *rootDir = archive.directory();
 
+    for (const auto &name : {QStringLiteral("lattedockrc"), QStringLiteral("lattedock-appletsrc")}) {
+        const KArchiveFile *fileEntry = rootDir->file(name);
+
+        if (fileEntry) {
+            fileEntry->copyTo(archiveTempDir.path());
+        }
+    }
 
     //rc file
     QString rcFile(archiveTempDir.path() + "/lattedockrc");
@@ -491,9 +584,9 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     }
 
     //latte directory
-    QString latteDir(archiveTempDir.path() + "/latte");
+    const KArchiveEntry *latteDir = rootDir->entry(QStringLiteral("latte"));
 
-    if (QDir(latteDir).exists()) {
+    if (latteDir && latteDir->isDirectory()) {
         version2LatteDir = true;
     }
 
@@ -514,7 +607,7 @@ bool Importer::importHelper(QString fileName)
         return false;
     }
 
-    KTar archive(fileName, QStringLiteral("application/x-tar"));
+    KTar archive(fileName);
     archive.open(QIODevice::ReadOnly);
 
     if (!archive.isOpen()) {
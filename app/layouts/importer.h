@@ -12,8 +12,15 @@
 #include "../apptypes.h"
 
 // Qt
+#include <QAtomicInt>
+#include <QList>
 #include <QObject>
+#include <QPair>
 #include <QTemporaryDir>
+#include <QThreadPool>
+
+// C++
+#include <functional>
 
 namespace Latte {
 namespace Layouts {
@@ -41,6 +48,14 @@ public:
     };
     Q_ENUM(LatteFileVersion);
 
+    enum ArchiveCompression
+    {
+        NoCompression = 0,
+        XzCompression,
+        ZstdCompression
+    };
+    Q_ENUM(ArchiveCompression);
+
     Importer(QObject *parent = nullptr);
     ~Importer() override;
 
@@ -59,7 +74,13 @@ public:
     //!     newName: if it is empty the name is extracted from the old config file name
     bool importOldConfiguration(QString oldConfigPath, QString newName = QString());
 
-    bool exportFullConfiguration(QString file);
+    bool exportFullConfiguration(QString file, ArchiveCompression compression = NoCompression);
+    //! the archive is written from a worker thread, progress and result
+    //! are reported through fullConfigurationExport* signals
+    void exportFullConfigurationInBackground(const QString &file, ArchiveCompression compression = NoCompression);
+    bool isExportingFullConfiguration() const;
+    //! compressions depend on the features that KArchive was built with
+    static bool isCompressionSupported(ArchiveCompression compression);
 
     QString storageTmpDir() const;
     //! imports the specific layout and return the new layout name.
@@ -116,11 +137,27 @@ public:
 signals:
     void newLayoutAdded(const QString &path);
 
+    void fullConfigurationExportProgress(const QString &file, int exported, int total);
+    void fullConfigurationExportFinished(const QString &file, bool succeeded);
+
 private:
+    //! local files and their paths inside the full configuration archive
+    QList<QPair<QString, QString>> fullConfigurationEntries() const;
+
+    //! can be called from worker threads
+    static bool writeArchive(const QString &file,
+                             ArchiveCompression compression,
+                             const QList<QPair<QString, QString>> &entries,
+                             std::function<void(int)> progress = nullptr);
+
     //! checks if this old layout can be imported. If it can it returns
     //! the new layout path and an empty string if it cant
     QString layoutCanBeImported(QString oldAppletsPath, QString newName, QString exportDirectory = QString());
 
+    QAtomicInt m_isExportingFullConfiguration{0};
+    //! background exports, they are finished before importer is destroyed
+    QThreadPool m_exportThreadPool;
+
     QTemporaryDir m_storageTmpDir;
 
     Layouts::Manager *m_manager;
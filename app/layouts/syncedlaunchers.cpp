@@ -39,8 +39,20 @@ void SyncedLaunchers::addAbilityClient(QQuickItem *client)
     }
 
     m_clients << client;
+    indexClient(client);
 
     connect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
+
+    //! keep indices updated when client identification properties change
+    QMetaMethod propertyChangedSlot = metaObject()->method(metaObject()->indexOfSlot("onClientPropertyChanged()"));
+
+    for (const char *name : {"clientId", "layoutName", "syncedGroupId"}) {
+        int propertyIndex = client->metaObject()->indexOfProperty(name);
+
+        if (propertyIndex != -1 && client->metaObject()->property(propertyIndex).hasNotifySignal()) {
+            connect(client, client->metaObject()->property(propertyIndex).notifySignal(), this, propertyChangedSlot);
+        }
+    }
 }
 
 void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
@@ -49,48 +61,114 @@ void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
         return;
     }
 
-    disconnect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
+    disconnect(client, nullptr, this, nullptr);
+    unindexClient(client);
+    m_clientMethods.remove(client);
     m_clients.removeAll(client);
 }
 
 void SyncedLaunchers::removeClientObject(QObject *obj)
 {
-    QQuickItem *item = qobject_cast<QQuickItem *>(obj);
+    QQuickItem *item = static_cast<QQuickItem *>(obj);
 
-    if (item) {
+    //! qobject_cast can not be used because the object is already in destruction
+    if (item && m_clients.contains(item)) {
         removeAbilityClient(item);
     }
 }
 
+void SyncedLaunchers::onClientPropertyChanged()
+{
+    QQuickItem *client = qobject_cast<QQuickItem *>(sender());
+
+    if (!client || !m_clients.contains(client)) {
+        return;
+    }
+
+    unindexClient(client);
+    indexClient(client);
+}
+
+void SyncedLaunchers::indexClient(QQuickItem *client)
+{
+    ClientRecord record;
+    record.id = client->property("clientId").toInt();
+    record.layoutName = client->property("layoutName").toString();
+    record.groupId = client->property("syncedGroupId").toString();
+
+    m_clientRecords[client] = record;
+
+    if (record.id > 0) {
+        m_clientsById[record.id] = client;
+    }
+
+    m_clientsByGroup[record.groupId] << client;
+    m_clientsByLayoutGroup[record.layoutName + "\n" + record.groupId] << client;
+}
+
+void SyncedLaunchers::unindexClient(QQuickItem *client)
+{
+    if (!m_clientRecords.contains(client)) {
+        return;
+    }
+
+    ClientRecord record = m_clientRecords.take(client);
+
+    if (m_clientsById.value(record.id) == client) {
+        m_clientsById.remove(record.id);
+    }
+
+    QString layoutGroupKey = record.layoutName + "\n" + record.groupId;
+
+    m_clientsByGroup[record.groupId].removeAll(client);
+    m_clientsByLayoutGroup[layoutGroupKey].removeAll(client);
+
+    if (m_clientsByGroup[record.groupId].isEmpty()) {
+        m_clientsByGroup.remove(record.groupId);
+    }
+
+    if (m_clientsByLayoutGroup[layoutGroupKey].isEmpty()) {
+        m_clientsByLayoutGroup.remove(layoutGroupKey);
+    }
+}
+
 QQuickItem *SyncedLaunchers::client(const int &id)
 {
     if (id <= 0) {
         return nullptr;
     }
 
-    for(const auto client: m_clients) {
-        int clientid = client->property("clientId").toInt();
-        if (clientid == id) {
-            return client;
-        }
+    return m_clientsById.value(id, nullptr);
+}
+
+QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, QString groupId)
+{
+    if (layoutName.isEmpty()) {
+        return m_clientsByGroup.value(groupId);
     }
 
-    return nullptr;
+    return m_clientsByLayoutGroup.value(layoutName + "\n" + groupId);
 }
 
-QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, QString groupId)
+QMetaMethod SyncedLaunchers::clientMethod(QQuickItem *client, const QByteArray &signature)
 {
-    QList<QQuickItem *> items;
+    QHash<QByteArray, QMetaMethod> &methods = m_clientMethods[client];
+
+    if (!methods.contains(signature)) {
+        QMetaMethod method;
 
-    for(const auto client: m_clients) {
-        QString cLayoutName = layoutName.isEmpty() ? QString() : client->property("layoutName").toString();
-        QString gid = client->property("syncedGroupId").toString();
-        if (cLayoutName == layoutName && gid == groupId) {
-            items << client;
+        if (auto *metaObject = client->metaObject()) {
+            int methodIndex = metaObject->indexOfMethod(signature);
+
+            if (methodIndex != -1) {
+                method = metaObject->method(methodIndex);
+            }
         }
+
+        methods[signature] = method;
     }
 
-    return items;
+    return methods[signature];
 }
 
 QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, uint senderId, Latte::Types::LaunchersGroup launcherGroup, QString launcherGroupId)
@@ -116,17 +194,14 @@ void SyncedLaunchers::addLauncher(QString layoutName, uint senderId, int launche
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncher(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        QMetaMethod method = clientMethod(c, "addSyncedLauncher(QVariant,QVariant)");
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
+        if (!method.isValid()) {
+            qDebug() << "Launchers Syncer Ability: addSyncedLauncher(QVariant,QVariant) was NOT found...";
+            continue;
         }
+
+        method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
     }
 }
 
@@ -136,17 +211,14 @@ void SyncedLaunchers::removeLauncher(QString layoutName, uint senderId, int laun
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncher(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        QMetaMethod method = clientMethod(c, "removeSyncedLauncher(QVariant,QVariant)");
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
+        if (!method.isValid()) {
+            qDebug() << "Launchers Syncer Ability: removeSyncedLauncher(QVariant,QVariant) was NOT found...";
+            continue;
         }
+
+        method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
     }
 }
 
@@ -156,17 +228,14 @@ void SyncedLaunchers::addLauncherToActivity(QString layoutName, uint senderId, i
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncherToActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        QMetaMethod method = clientMethod(c, "addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
+        if (!method.isValid()) {
+            qDebug() << "Launchers Syncer Ability: addSyncedLauncherToActivity(QVariant,QVariant,QVariant) was NOT found...";
+            continue;
         }
+
+        method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
     }
 }
 
@@ -176,17 +245,14 @@ void SyncedLaunchers::removeLauncherFromActivity(QString layoutName, uint sender
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        QMetaMethod method = clientMethod(c, "removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
+        if (!method.isValid()) {
+            qDebug() << "Launchers Syncer Ability: removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant) was NOT found...";
+            continue;
         }
+
+        method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
     }
 }
 
@@ -196,17 +262,14 @@ void SyncedLaunchers::urlsDropped(QString layoutName, uint senderId, int launche
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("dropSyncedUrls(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: dropSyncedUrls(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        QMetaMethod method = clientMethod(c, "dropSyncedUrls(QVariant,QVariant)");
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
+        if (!method.isValid()) {
+            qDebug() << "Launchers Syncer Ability: dropSyncedUrls(QVariant,QVariant) was NOT found...";
+            continue;
         }
+
+        method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
     }
 }
 
@@ -219,17 +282,14 @@ void SyncedLaunchers::validateLaunchersOrder(QString layoutName, uint senderId,
         auto tc = client(senderId);
 
         if (c != tc) {
-            if (auto *metaObject = c->metaObject()) {
-                int methodIndex = metaObject->indexOfMethod("validateSyncedLaunchersOrder(QVariant,QVariant)");
-
-                if (methodIndex == -1) {
-                    qDebug() << "Launchers Syncer Ability: validateSyncedLaunchersOrder(QVariant,QVariant) was NOT found...";
-                    continue;
-                }
+            QMetaMethod method = clientMethod(c, "validateSyncedLaunchersOrder(QVariant,QVariant)");
 
-                QMetaMethod method = metaObject->method(methodIndex);
-                method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
+            if (!method.isValid()) {
+                qDebug() << "Launchers Syncer Ability: validateSyncedLaunchersOrder(QVariant,QVariant) was NOT found...";
+                continue;
             }
+
+            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
         }
     }
 }
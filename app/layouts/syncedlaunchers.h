@@ -10,7 +10,9 @@
 #include <coretypes.h>
 
 // Qt
+#include <QHash>
 #include <QList>
+#include <QMetaMethod>
 #include <QObject>
 #include <QQuickItem>
 
@@ -57,13 +59,36 @@ private:
     QList<QQuickItem *> clients(QString layoutName, uint senderId, Latte::Types::LaunchersGroup launcherGroup, QString launcherGroupId);
     QQuickItem *client(const int &id);
 
+    QMetaMethod clientMethod(QQuickItem *client, const QByteArray &signature);
+
+    void indexClient(QQuickItem *client);
+    void unindexClient(QQuickItem *client);
+
 private slots:
     void removeClientObject(QObject *obj);
+    void onClientPropertyChanged();
 
 private:
+    struct ClientRecord
+    {
+        int id{-1};
+        QString layoutName;
+        QString groupId;
+    };
+
     Layouts::Manager *m_manager{nullptr};
 
     QList<QQuickItem *> m_clients;
+
+    //! indices in order to avoid reading clients properties through the meta-object
+    //! system for every launcher that is synced
+    QHash<QQuickItem *, ClientRecord> m_clientRecords;
+    QHash<int, QQuickItem *> m_clientsById;
+    QHash<QString, QList<QQuickItem *>> m_clientsByGroup;
+    QHash<QString, QList<QQuickItem *>> m_clientsByLayoutGroup;
+
+    //! resolved client methods, signature -> method
+    QHash<QQuickItem *, QHash<QByteArray, QMetaMethod>> m_clientMethods;
 };
 
 }
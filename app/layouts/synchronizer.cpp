@@ -17,6 +17,7 @@
 #include "../layout/genericlayout.h"
 #include "../settings/universalsettings.h"
 #include "../templates/templatesmanager.h"
+#include "../tools/profiler.h"
 #include "../view/view.h"
 
 // Qt
@@ -573,6 +574,8 @@ void Synchronizer::unloadCentralLayout(CentralLayout *layout)
 
 void Synchronizer::initLayouts()
 {
+    Profiler::Scope profilerScope("loading", "initLayouts");
+
     m_layouts.clear();
 
     QDir layoutDir(Layouts::Importer::layoutUserDir());
@@ -11,6 +11,7 @@
 #include "lattecorona.h"
 #include "layouts/importer.h"
 #include "templates/templatesmanager.h"
+#include "tools/profiler.h"
 
 // C++
 #include <memory>
@@ -182,10 +183,19 @@ int main(int argc, char **argv)
     filterDebugLogCmd.setFlags(QCommandLineOption::HiddenFromHelp);
     filterDebugLogCmd.setValueName(i18nc("command line: log-filepath", "filter_log_filepath"));
     parser.addOption(filterDebugLogCmd);
+
+    QCommandLineOption profilerOption(QStringList() << QStringLiteral("profiler"));
+    profilerOption.setDescription(QStringLiteral("Record views rendering and tracking timings, they can be exported through the profilerTrace dbus method."));
+    profilerOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOption(profilerOption);
     //! END: Hidden options
 
     parser.process(app);
 
+    if (parser.isSet(QStringLiteral("profiler"))) {
+        Latte::Profiler::self()->setEnabled(true);
+    }
+
     if (parser.isSet(QStringLiteral("enable-autostart"))) {
         Latte::Layouts::Importer::enableAutostart();
     }
@@ -7,6 +7,8 @@
 
 // local
 #include "../../tools/commontools.h"
+#include "../../tools/filewatcher.h"
+#include "../../tools/profiler.h"
 
 // Qt
 #include <QDebug>
@@ -22,7 +24,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 
 #define MAXHASHSIZE 300
 
@@ -45,10 +46,7 @@ BackgroundCache::BackgroundCache(QObject *parent)
 
     qDebug() << "Default Wallpaper path ::: " << m_defaultWallpaperPath;
 
-    KDirWatch::self()->addFile(configFile);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &BackgroundCache::settingsFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &BackgroundCache::settingsFileChanged);
+    connect(FileWatcher::self()->addFile(configFile), &WatchedPath::changed, this, &BackgroundCache::settingsFileChanged);
 
     if (!m_pool) {
         m_pool = new ScreenPool(this);
@@ -116,6 +114,8 @@ bool BackgroundCache::isDesktopContainment(const KConfigGroup &containment) cons
 
 void BackgroundCache::reload()
 {
+    Profiler::Scope profilerScope("loading", "backgroundsReload");
+
     // Traversing through all containments in search for
     // containments that define activities in plasma
     KConfigGroup plasmaConfigContainments = m_plasmaConfig->group("Containments");
@@ -8,6 +8,7 @@
 // local
 #include "../../primaryoutputwatcher.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatcher.h"
 
 // Qt
 #include <QDebug>
@@ -17,7 +18,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KSharedConfig>
 
 #define PLASMARC "plasmashellrc"
@@ -36,19 +36,7 @@ ScreenPool::ScreenPool(QObject *parent)
 
     QString plasmaSettingsFile = Latte::configPath() + "/" + PLASMARC;
 
-    KDirWatch::self()->addFile(plasmaSettingsFile);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, plasmaSettingsFile](const QString & path) {
-        if (path == plasmaSettingsFile) {
-            load();
-        }
-    });
-
-    connect(KDirWatch::self(), &KDirWatch::created, this, [ &, plasmaSettingsFile](const QString & path) {
-        if (path == plasmaSettingsFile) {
-            load();
-        }
-    });
+    connect(FileWatcher::self()->addFile(plasmaSettingsFile), &WatchedPath::changed, this, &ScreenPool::load);
 }
 
 
@@ -12,6 +12,7 @@
 #include "../../view/panelshadows_p.h"
 #include "../../wm/schemecolors.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatcher.h"
 
 // Qt
 #include <QDebug>
@@ -19,7 +20,7 @@
 #include <QPainter>
 
 // KDE
-#include <KDirWatch>
+#include <KConfig>
 #include <KConfigGroup>
 #include <KSharedConfig>
 
@@ -81,6 +82,7 @@ void Theme::load()
 Theme::~Theme()
 {
     saveConfig();
+    untrackKdeSettings();
 
     m_defaultScheme->deleteLater();
     m_reversedScheme->deleteLater();
@@ -183,8 +185,12 @@ void Theme::setOriginalSchemeFile(const QString &file)
 
     qDebug() << "plasma theme original colors ::: " << m_originalSchemePath;
 
-    updateDefaultScheme();
-    updateReversedScheme();
+    //! the original scheme is parsed once and both schemes are derived from it in memory,
+    //! groups that are missing from the scheme fall back to kdeglobals
+    KConfig original(m_originalSchemePath, KConfig::IncludeGlobals);
+
+    updateDefaultScheme(&original);
+    updateReversedScheme(&original);
 
     loadThemeLightness();
 
@@ -195,123 +201,97 @@ void Theme::setOriginalSchemeFile(const QString &file)
 //! plasma will use in order to be consistent. Such an example
 //! are the Breeze color schemes that have different values for
 //! WM and the plasma theme records
-void Theme::updateDefaultScheme()
+void Theme::updateDefaultScheme(const KConfigBase *original)
 {
-    QString defaultFilePath = m_extendedThemeDir.path() + "/" + DEFAULTCOLORSCHEME;
-    if (QFileInfo(defaultFilePath).exists()) {
-        QFile(defaultFilePath).remove();
-    }
+    KConfig *scheme = new KConfig(QString(), KConfig::SimpleConfig);
+    WindowSystem::SchemeColors::copyScheme(original, scheme);
+    updateDefaultSchemeValues(original, scheme);
 
-    QFile(m_originalSchemePath).copy(defaultFilePath);
-    m_defaultSchemePath = defaultFilePath;
-
-    updateDefaultSchemeValues();
+    m_defaultSchemePath = m_extendedThemeDir.path() + "/" + DEFAULTCOLORSCHEME;
 
     if (m_defaultScheme) {
         disconnect(m_defaultScheme, &WindowSystem::SchemeColors::colorsChanged, this, &Theme::loadThemeLightness);
         m_defaultScheme->deleteLater();
     }
 
-    m_defaultScheme = new WindowSystem::SchemeColors(this, m_defaultSchemePath, true);
+    m_defaultScheme = new WindowSystem::SchemeColors(this, scheme, m_defaultSchemePath, true);
     connect(m_defaultScheme, &WindowSystem::SchemeColors::colorsChanged, this, &Theme::loadThemeLightness);
 
     qDebug() << "plasma theme default colors ::: " << m_defaultSchemePath;
 }
 
-void Theme::updateDefaultSchemeValues()
+void Theme::updateDefaultSchemeValues(const KConfigBase *original, KConfigBase *scheme)
 {
     //! update WM values based on original scheme
-    KSharedConfigPtr originalPtr = KSharedConfig::openConfig(m_originalSchemePath);
-    KSharedConfigPtr defaultPtr = KSharedConfig::openConfig(m_defaultSchemePath);
-
-    if (originalPtr && defaultPtr) {
-        KConfigGroup normalWindowGroup(originalPtr, "Colors:Window");
-        KConfigGroup defaultWMGroup(defaultPtr, "WM");
+    KConfigGroup normalWindowGroup(original, "Colors:Window");
+    KConfigGroup defaultWMGroup(scheme, "WM");
 
-        defaultWMGroup.writeEntry("activeBackground", normalWindowGroup.readEntry("BackgroundNormal", QColor()));
-        defaultWMGroup.writeEntry("activeForeground", normalWindowGroup.readEntry("ForegroundNormal", QColor()));
-
-        defaultWMGroup.sync();
-    }
+    defaultWMGroup.writeEntry("activeBackground", normalWindowGroup.readEntry("BackgroundNormal", QColor()));
+    defaultWMGroup.writeEntry("activeForeground", normalWindowGroup.readEntry("ForegroundNormal", QColor()));
 }
 
-void Theme::updateReversedScheme()
+void Theme::updateReversedScheme(const KConfigBase *original)
 {
-    QString reversedFilePath = m_extendedThemeDir.path() + "/" + REVERSEDCOLORSCHEME;
-
-    if (QFileInfo(reversedFilePath).exists()) {
-        QFile(reversedFilePath).remove();
-    }
-
-    QFile(m_originalSchemePath).copy(reversedFilePath);
-    m_reversedSchemePath = reversedFilePath;
+    KConfig *scheme = new KConfig(QString(), KConfig::SimpleConfig);
+    WindowSystem::SchemeColors::copyScheme(original, scheme);
+    updateReversedSchemeValues(original, scheme);
 
-    updateReversedSchemeValues();
+    m_reversedSchemePath = m_extendedThemeDir.path() + "/" + REVERSEDCOLORSCHEME;
 
     if (m_reversedScheme) {
         m_reversedScheme->deleteLater();
     }
 
-    m_reversedScheme = new WindowSystem::SchemeColors(this, m_reversedSchemePath, true);
+    m_reversedScheme = new WindowSystem::SchemeColors(this, scheme, m_reversedSchemePath, true);
 
     qDebug() << "plasma theme reversed colors ::: " << m_reversedSchemePath;
 }
 
-void Theme::updateReversedSchemeValues()
+void Theme::updateReversedSchemeValues(const KConfigBase *original, KConfigBase *scheme)
 {
     //! reverse values based on original scheme
-    KSharedConfigPtr originalPtr = KSharedConfig::openConfig(m_originalSchemePath);
-    KSharedConfigPtr reversedPtr = KSharedConfig::openConfig(m_reversedSchemePath);
-
-    if (originalPtr && reversedPtr) {
-        for (const auto &groupName : reversedPtr->groupList()) {
-            if (groupName != "Colors:Button" && groupName != "Colors:Selection") {
-                KConfigGroup reversedGroup(reversedPtr, groupName);
-
-                if (reversedGroup.keyList().contains("BackgroundNormal")
-                        && reversedGroup.keyList().contains("ForegroundNormal")) {
-                    //! reverse usual text/background values
-                    KConfigGroup originalGroup(originalPtr, groupName);
+    for (const auto &groupName : scheme->groupList()) {
+        if (groupName != "Colors:Button" && groupName != "Colors:Selection") {
+            KConfigGroup reversedGroup(scheme, groupName);
 
-                    reversedGroup.writeEntry("BackgroundNormal", originalGroup.readEntry("ForegroundNormal", QColor()));
-                    reversedGroup.writeEntry("ForegroundNormal", originalGroup.readEntry("BackgroundNormal", QColor()));
+            if (reversedGroup.keyList().contains("BackgroundNormal")
+                    && reversedGroup.keyList().contains("ForegroundNormal")) {
+                //! reverse usual text/background values
+                KConfigGroup originalGroup(original, groupName);
 
-                    reversedGroup.sync();
-                }
+                reversedGroup.writeEntry("BackgroundNormal", originalGroup.readEntry("ForegroundNormal", QColor()));
+                reversedGroup.writeEntry("ForegroundNormal", originalGroup.readEntry("BackgroundNormal", QColor()));
             }
         }
+    }
 
-        //! update WM group
-        KConfigGroup reversedWMGroup(reversedPtr, "WM");
-        KConfigGroup normalWindowGroup(originalPtr, "Colors:Window");
-
-        if (reversedWMGroup.keyList().contains("activeBackground")
-                && reversedWMGroup.keyList().contains("activeForeground")
-                && reversedWMGroup.keyList().contains("inactiveBackground")
-                && reversedWMGroup.keyList().contains("inactiveForeground")) {
-            //! reverse usual wm titlebar values
-            KConfigGroup originalGroup(originalPtr, "WM");
-            reversedWMGroup.writeEntry("activeBackground", normalWindowGroup.readEntry("ForegroundNormal", QColor()));
-            reversedWMGroup.writeEntry("activeForeground", normalWindowGroup.readEntry("BackgroundNormal", QColor()));
-            reversedWMGroup.writeEntry("inactiveBackground", originalGroup.readEntry("inactiveForeground", QColor()));
-            reversedWMGroup.writeEntry("inactiveForeground", originalGroup.readEntry("inactiveBackground", QColor()));
-            reversedWMGroup.sync();
-        }
-
-        if (reversedWMGroup.keyList().contains("activeBlend")
-                && reversedWMGroup.keyList().contains("inactiveBlend")) {
-            KConfigGroup originalGroup(originalPtr, "WM");
-            reversedWMGroup.writeEntry("activeBlend", originalGroup.readEntry("inactiveBlend", QColor()));
-            reversedWMGroup.writeEntry("inactiveBlend", originalGroup.readEntry("activeBlend", QColor()));
-            reversedWMGroup.sync();
-        }
+    //! update WM group
+    KConfigGroup reversedWMGroup(scheme, "WM");
+    KConfigGroup normalWindowGroup(original, "Colors:Window");
+
+    if (reversedWMGroup.keyList().contains("activeBackground")
+            && reversedWMGroup.keyList().contains("activeForeground")
+            && reversedWMGroup.keyList().contains("inactiveBackground")
+            && reversedWMGroup.keyList().contains("inactiveForeground")) {
+        //! reverse usual wm titlebar values
+        KConfigGroup originalGroup(original, "WM");
+        reversedWMGroup.writeEntry("activeBackground", normalWindowGroup.readEntry("ForegroundNormal", QColor()));
+        reversedWMGroup.writeEntry("activeForeground", normalWindowGroup.readEntry("BackgroundNormal", QColor()));
+        reversedWMGroup.writeEntry("inactiveBackground", originalGroup.readEntry("inactiveForeground", QColor()));
+        reversedWMGroup.writeEntry("inactiveForeground", originalGroup.readEntry("inactiveBackground", QColor()));
+    }
 
-        //! update scheme name
-        QString originalSchemeName = WindowSystem::SchemeColors::schemeName(m_originalSchemePath);
-        KConfigGroup generalGroup(reversedPtr, "General");
-        generalGroup.writeEntry("Name", originalSchemeName + "_reversed");
-        generalGroup.sync();
+    if (reversedWMGroup.keyList().contains("activeBlend")
+            && reversedWMGroup.keyList().contains("inactiveBlend")) {
+        KConfigGroup originalGroup(original, "WM");
+        reversedWMGroup.writeEntry("activeBlend", originalGroup.readEntry("inactiveBlend", QColor()));
+        reversedWMGroup.writeEntry("inactiveBlend", originalGroup.readEntry("activeBlend", QColor()));
     }
+
+    //! update scheme name
+    QString originalSchemeName = WindowSystem::SchemeColors::schemeName(m_originalSchemePath);
+    KConfigGroup generalGroup(scheme, "General");
+    generalGroup.writeEntry("Name", originalSchemeName + "_reversed");
 }
 
 void Theme::updateBackgrounds()
@@ -370,10 +350,8 @@ void Theme::loadThemePaths()
     qDebug() << "theme path ::: " << m_themePath;
     qDebug() << "theme widgets path ::: " << m_themeWidgetsPath;
 
-    //! clear kde connections
-    for (auto &c : m_kdeConnections) {
-        disconnect(c);
-    }
+    //! clear kde connection
+    untrackKdeSettings();
 
     //! assign color schemes
     QString themeColorScheme = m_themePath + "/colors";
@@ -383,26 +361,26 @@ void Theme::loadThemePaths()
     } else {
         //! when plasma theme uses the kde colors
         //! we track when kde color scheme is changing
-        QString kdeSettingsFile = Latte::configPath() + "/kdeglobals";
-
-        KDirWatch::self()->addFile(kdeSettingsFile);
-
-        m_kdeConnections[0] = connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, kdeSettingsFile](const QString & path) {
-            if (path == kdeSettingsFile) {
-                this->setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
-            }
-        });
+        m_kdeSettingsFile = Latte::configPath() + "/kdeglobals";
 
-        m_kdeConnections[1] = connect(KDirWatch::self(), &KDirWatch::created, this, [ &, kdeSettingsFile](const QString & path) {
-            if (path == kdeSettingsFile) {
-                this->setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
-            }
+        m_kdeConnection = connect(FileWatcher::self()->addFile(m_kdeSettingsFile), &WatchedPath::changed, this, [&]() {
+            this->setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
         });
 
         setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
     }
 }
 
+void Theme::untrackKdeSettings()
+{
+    disconnect(m_kdeConnection);
+
+    if (!m_kdeSettingsFile.isEmpty()) {
+        FileWatcher::self()->removePath(m_kdeSettingsFile);
+        m_kdeSettingsFile.clear();
+    }
+}
+
 void Theme::loadThemeLightness()
 {
     float textColorLum = Latte::colorLumina(m_defaultScheme->textColor());
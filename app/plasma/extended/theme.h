@@ -6,9 +6,6 @@
 #ifndef PLASMATHEMEEXTENDED_H
 #define PLASMATHEMEEXTENDED_H
 
-// C++
-#include <array>
-
 // Qt
 #include <QObject>
 #include <QHash>
@@ -112,16 +109,17 @@ private slots:
 
 private:
     void loadThemePaths();
+    void untrackKdeSettings();
     void loadCompositingRoundness();
     void updateBackgrounds();
 
     void setOriginalSchemeFile(const QString &file);
     void updateHasShadow();
-    void updateDefaultScheme();
-    void updateDefaultSchemeValues();
+    void updateDefaultScheme(const KConfigBase *original);
+    void updateDefaultSchemeValues(const KConfigBase *original, KConfigBase *scheme);
     void updateMarginsAreaValues();
-    void updateReversedScheme();
-    void updateReversedSchemeValues();
+    void updateReversedScheme(const KConfigBase *original);
+    void updateReversedSchemeValues(const KConfigBase *original, KConfigBase *scheme);
 
     void qmlRegisterTypes();
 
@@ -145,7 +143,9 @@ private:
 
     QHash<int, CornerRegions> m_cornerRegions;
 
-    std::array<QMetaObject::Connection, 2> m_kdeConnections;
+    QMetaObject::Connection m_kdeConnection;
+    //! kde settings file is tracked only when the plasma theme uses the kde colors
+    QString m_kdeSettingsFile;
 
     QTemporaryDir m_extendedThemeDir;
     KConfigGroup m_themeGroup;
@@ -9,6 +9,7 @@
 // local
 #include <config-latte.h>
 #include "primaryoutputwatcher.h"
+#include "tools/profiler.h"
 
 // Qt
 #include <QDebug>
@@ -53,6 +54,8 @@ ScreenPool::~ScreenPool()
 
 void ScreenPool::load()
 {
+    Profiler::Scope profilerScope("loading", "screenPoolLoad");
+
     m_screensTable.clear();
 
     //restore the known ids to connector mappings
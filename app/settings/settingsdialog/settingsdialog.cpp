@@ -139,6 +139,10 @@ void SettingsDialog::initFileMenu()
     m_exportFullAction->setToolTip(i18n("Export your full configuration to create backup"));
     connect(m_exportFullAction, &QAction::triggered, this, &SettingsDialog::exportFullConfiguration);
 
+    auto importer = m_corona->layoutsManager()->importer();
+    connect(importer, &Latte::Layouts::Importer::fullConfigurationExportProgress, this, &SettingsDialog::onFullConfigurationExportProgress);
+    connect(importer, &Latte::Layouts::Importer::fullConfigurationExportFinished, this, &SettingsDialog::onFullConfigurationExportFinished);
+
     m_fileMenu->addSeparator();
 
     QAction *screensAction = m_fileMenu->addAction(i18n("&Screens..."));
@@ -316,6 +320,10 @@ void SettingsDialog::importFullConfiguration()
 
 void SettingsDialog::exportFullConfiguration()
 {
+    if (m_corona->layoutsManager()->importer()->isExportingFullConfiguration()) {
+        return;
+    }
+
     //! Update ALL active original layouts before exporting,
     m_corona->layoutsManager()->synchronizer()->syncActiveLayoutsToOriginalFiles();
 
@@ -330,42 +338,33 @@ void SettingsDialog::exportFullConfiguration()
 
     QStringList filters;
     QString filter2(i18nc("export full configuration", "Latte Dock Full Configuration file v0.2") + "(*.latterc)");
+    QString filter2Xz(i18nc("export full configuration", "Latte Dock Full Configuration file v0.2, xz compressed") + "(*.latterc)");
+    QString filter2Zstd(i18nc("export full configuration", "Latte Dock Full Configuration file v0.2, zstd compressed") + "(*.latterc)");
 
     filters << filter2;
 
+    if (Latte::Layouts::Importer::isCompressionSupported(Latte::Layouts::Importer::XzCompression)) {
+        filters << filter2Xz;
+    }
+
+    if (Latte::Layouts::Importer::isCompressionSupported(Latte::Layouts::Importer::ZstdCompression)) {
+        filters << filter2Zstd;
+    }
+
     exportFileDialog->setNameFilters(filters);
 
     connect(exportFileDialog, &QFileDialog::finished, exportFileDialog, &QFileDialog::deleteLater);
 
-    connect(exportFileDialog, &QFileDialog::fileSelected, this, [&](const QString & file) {
-        auto showExportConfigurationError = [this]() {
-            showInlineMessage(i18n("Full configuration export <b>failed</b>..."),
-                              KMessageWidget::Error,
-                              true);
-        };
-
-        if (m_corona->layoutsManager()->importer()->exportFullConfiguration(file)) {
-            QAction *openUrlAction = new QAction(i18n("Open Location..."), this);
-            openUrlAction->setIcon(QIcon::fromTheme("document-open"));
-            openUrlAction->setData(file);
-            QList<QAction *> actions;
-            actions << openUrlAction;
-
-            connect(openUrlAction, &QAction::triggered, this, [&, openUrlAction]() {
-                QString file = openUrlAction->data().toString();
-
-                if (!file.isEmpty()) {
-                    KIO::highlightInFileManager({file});
-                }
-            });
+    connect(exportFileDialog, &QFileDialog::fileSelected, this, [this, exportFileDialog, filter2Xz, filter2Zstd](const QString & file) {
+        Latte::Layouts::Importer::ArchiveCompression compression{Latte::Layouts::Importer::NoCompression};
 
-            showInlineMessage(i18n("Full configuration export succeeded..."),
-                              KMessageWidget::Positive,
-                              false,
-                              actions);
-        } else {
-            showExportConfigurationError();
+        if (exportFileDialog->selectedNameFilter() == filter2Xz) {
+            compression = Latte::Layouts::Importer::XzCompression;
+        } else if (exportFileDialog->selectedNameFilter() == filter2Zstd) {
+            compression = Latte::Layouts::Importer::ZstdCompression;
         }
+
+        m_corona->layoutsManager()->importer()->exportFullConfigurationInBackground(file, compression);
     });
 
     exportFileDialog->open();
@@ -376,6 +375,48 @@ void SettingsDialog::exportFullConfiguration()
     exportFileDialog->selectFile(proposedName);
 }
 
+void SettingsDialog::onFullConfigurationExportProgress(const QString &file, int exported, int total)
+{
+    Q_UNUSED(file)
+
+    int percentage = total > 0 ? (100 * exported) / total : 0;
+
+    m_exportFullAction->setEnabled(false);
+    m_exportFullAction->setText(i18nc("export full configuration progress", "Exporting Configuration... %1%", percentage));
+}
+
+void SettingsDialog::onFullConfigurationExportFinished(const QString &file, bool succeeded)
+{
+    m_exportFullAction->setEnabled(true);
+    m_exportFullAction->setText(i18n("Export Configuration..."));
+
+    if (!succeeded) {
+        showInlineMessage(i18n("Full configuration export <b>failed</b>..."),
+                          KMessageWidget::Error,
+                          true);
+        return;
+    }
+
+    QAction *openUrlAction = new QAction(i18n("Open Location..."), this);
+    openUrlAction->setIcon(QIcon::fromTheme("document-open"));
+    openUrlAction->setData(file);
+    QList<QAction *> actions;
+    actions << openUrlAction;
+
+    connect(openUrlAction, &QAction::triggered, this, [&, openUrlAction]() {
+        QString file = openUrlAction->data().toString();
+
+        if (!file.isEmpty()) {
+            KIO::highlightInFileManager({file});
+        }
+    });
+
+    showInlineMessage(i18n("Full configuration export succeeded..."),
+                      KMessageWidget::Positive,
+                      false,
+                      actions);
+}
+
 void SettingsDialog::showScreensDialog()
 {
     auto screensDlg = new Settings::Dialog::ScreensDialog(this, m_tabLayoutsHandler->layoutsController());
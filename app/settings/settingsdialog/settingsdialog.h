@@ -84,6 +84,8 @@ protected:
 private slots:
     void importFullConfiguration();
     void exportFullConfiguration();
+    void onFullConfigurationExportProgress(const QString &file, int exported, int total);
+    void onFullConfigurationExportFinished(const QString &file, bool succeeded);
 
     void showScreensDialog();
 
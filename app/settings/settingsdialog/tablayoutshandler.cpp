@@ -684,34 +684,8 @@ void TabLayouts::exportLayoutForBackup()
                               false,
                               actions);
         } else if (file.endsWith(".latterc")) {
-            auto showExportConfigurationError = [this]() {
-                showInlineMessage(i18n("Full configuration export <b>failed</b>..."),
-                                  KMessageWidget::Error,
-                                  true);
-            };
-
-            if (m_corona->layoutsManager()->importer()->exportFullConfiguration(file)) {
-                QAction *openUrlAction = new QAction(i18n("Open Location..."), this);
-                openUrlAction->setIcon(QIcon::fromTheme("document-open"));
-                openUrlAction->setData(file);
-                QList<QAction *> actions;
-                actions << openUrlAction;
-
-                connect(openUrlAction, &QAction::triggered, this, [&, openUrlAction]() {
-                    QString file = openUrlAction->data().toString();
-
-                    if (!file.isEmpty()) {
-                        KIO::highlightInFileManager({file});
-                    }
-                });
-
-                showInlineMessage(i18n("Full configuration export succeeded..."),
-                                  KMessageWidget::Positive,
-                                  false,
-                                  actions);
-            } else {
-                showExportConfigurationError();
-            }
+            //! the archive is written in the background, progress and result are shown from the settings dialog
+            m_corona->layoutsManager()->importer()->exportFullConfigurationInBackground(file);
         }
     });
 
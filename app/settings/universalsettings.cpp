@@ -14,6 +14,7 @@
 #include "../layouts/importer.h"
 #include "../layouts/manager.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatcher.h"
 
 // Qt
 #include <QDebug>
@@ -22,7 +23,6 @@
 
 // KDE
 #include <KActivities/Consumer>
-#include <KDirWatch>
 #include <KWindowSystem>
 
 #define KWINMETAFORWARDTOLATTESTRING "org.kde.lattedock,/Latte,org.kde.LatteDock,activateLauncherMenu"
@@ -99,22 +99,22 @@ void UniversalSettings::load()
 
     QStringList colorsScriptPaths = Layouts::Importer::standardPathsFor(KWINCOLORSSCRIPT);
     for(auto path: colorsScriptPaths) {
-        KDirWatch::self()->addDir(path);
+        WatchedPath *colorsScriptDir = FileWatcher::self()->addDir(path);
+        connect(colorsScriptDir, &WatchedPath::changed, this, &UniversalSettings::trackedFileChanged);
+        connect(colorsScriptDir, &WatchedPath::deleted, this, &UniversalSettings::trackedFileChanged);
     }
 
     //! Track KWin rc options
     const QString kwinrcFilePath = Latte::configPath() + "/" + KWINRC;
-    KDirWatch::self()->addFile(kwinrcFilePath);
+    WatchedPath *kwinrcFile = FileWatcher::self()->addFile(kwinrcFilePath);
+    connect(kwinrcFile, &WatchedPath::changed, this, &UniversalSettings::trackedFileChanged);
+    connect(kwinrcFile, &WatchedPath::deleted, this, &UniversalSettings::trackedFileChanged);
     recoverKWinOptions();
 
     m_kwinrcTrackerTimer.setSingleShot(true);
     m_kwinrcTrackerTimer.setInterval(KWINRCTRACKERINTERVAL);
     connect(&m_kwinrcTrackerTimer, &QTimer::timeout, this, &UniversalSettings::recoverKWinOptions);
 
-    connect(KDirWatch::self(), &KDirWatch::created, this, &UniversalSettings::trackedFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, &UniversalSettings::trackedFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &UniversalSettings::trackedFileChanged);
-
     //! this is needed to inform globalshortcuts to update its modifiers tracking
     emit metaPressAndHoldEnabledChanged();
 }
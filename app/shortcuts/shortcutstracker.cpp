@@ -6,6 +6,7 @@
 // local
 #include "shortcutstracker.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatcher.h"
 
 // Qt
 #include <QAction>
@@ -15,7 +16,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KGlobalAccel>
 
 
@@ -47,10 +47,7 @@ void ShortcutsTracker::initGlobalShortcutsWatcher()
     const QString globalShortcutsFilePath = Latte::configPath() + "/" + GLOBALSHORTCUTSCONFIG;
     m_shortcutsConfigPtr = KSharedConfig::openConfig(globalShortcutsFilePath);
 
-    KDirWatch::self()->addFile(globalShortcutsFilePath);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &ShortcutsTracker::shortcutsFileChanged, Qt::QueuedConnection);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &ShortcutsTracker::shortcutsFileChanged, Qt::QueuedConnection);
+    connect(FileWatcher::self()->addFile(globalShortcutsFilePath), &WatchedPath::changed, this, &ShortcutsTracker::shortcutsFileChanged, Qt::QueuedConnection);
 }
 
 bool ShortcutsTracker::basedOnPositionEnabled() const
@@ -12,13 +12,13 @@
 #include "../layouts/manager.h"
 #include "../layouts/storage.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatcher.h"
 #include "../view/view.h"
 
 // Qt
 #include <QDir>
 
 // KDE
-#include <KDirWatch>
 #include <KLocalizedString>
 
 namespace Latte {
@@ -28,10 +28,9 @@ Manager::Manager(Latte::Corona *corona)
     : QObject(corona),
       m_corona(corona)
 {
-    KDirWatch::self()->addDir(Latte::configPath() + "/latte/templates", KDirWatch::WatchFiles);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &Manager::onCustomTemplatesCountChanged);
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, &Manager::onCustomTemplatesCountChanged);
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &Manager::onCustomTemplatesCountChanged);
+    WatchedPath *templatesDir = FileWatcher::self()->addDir(Latte::configPath() + "/latte/templates", KDirWatch::WatchFiles);
+    connect(templatesDir, &WatchedPath::changed, this, &Manager::onCustomTemplatesCountChanged);
+    connect(templatesDir, &WatchedPath::deleted, this, &Manager::onCustomTemplatesCountChanged);
 }
 
 Manager::~Manager()
@@ -0,0 +1,154 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "filewatcher.h"
+
+// Qt
+#include <QFileInfo>
+
+#define FLUSHINTERVAL 150
+#define FLUSHMAXDELAY 1000
+
+namespace Latte {
+
+WatchedPath::WatchedPath(const QString &path, bool isDir, bool watchFiles, QObject *parent)
+    : QObject(parent),
+      m_isDir(isDir),
+      m_watchFiles(watchFiles),
+      m_path(path)
+{
+    m_flushTimer.setInterval(FLUSHINTERVAL);
+    m_flushTimer.setSingleShot(true);
+    connect(&m_flushTimer, &QTimer::timeout, this, &WatchedPath::flush);
+}
+
+QString WatchedPath::path() const
+{
+    return m_path;
+}
+
+void WatchedPath::addEvent(const QString &path)
+{
+    if (m_pendingPaths.isEmpty()) {
+        m_pendingTime.start();
+    }
+
+    if (!m_pendingPaths.contains(path)) {
+        m_pendingPaths << path;
+    }
+
+    //! restarting the timer delays the delivery until writes have settled, paths
+    //! that keep changing can not delay it more than FLUSHMAXDELAY ms
+    if (!m_flushTimer.isActive() || m_pendingTime.elapsed() < (FLUSHMAXDELAY - FLUSHINTERVAL)) {
+        m_flushTimer.start();
+    }
+}
+
+void WatchedPath::flush()
+{
+    const QStringList paths = m_pendingPaths;
+    m_pendingPaths.clear();
+    m_pendingTime.invalidate();
+
+    //! files that are saved atomically are deleted and created again,
+    //! their final state is what matters
+    for (const auto &path : paths) {
+        if (QFileInfo::exists(path)) {
+            emit changed(path);
+        } else {
+            emit deleted(path);
+        }
+    }
+}
+
+FileWatcher::FileWatcher(QObject *parent)
+    : QObject(parent)
+{
+    connect(KDirWatch::self(), &KDirWatch::created, this, &FileWatcher::onPathEvent);
+    connect(KDirWatch::self(), &KDirWatch::dirty, this, &FileWatcher::onPathEvent);
+    connect(KDirWatch::self(), &KDirWatch::deleted, this, &FileWatcher::onPathEvent);
+}
+
+FileWatcher::~FileWatcher()
+{
+    qDeleteAll(m_paths);
+    m_paths.clear();
+}
+
+FileWatcher *FileWatcher::self()
+{
+    static FileWatcher watcher;
+    return &watcher;
+}
+
+WatchedPath *FileWatcher::addFile(const QString &file)
+{
+    return addPath(file, false, KDirWatch::WatchDirOnly);
+}
+
+WatchedPath *FileWatcher::addDir(const QString &dir, KDirWatch::WatchModes watchModes)
+{
+    return addPath(dir, true, watchModes);
+}
+
+WatchedPath *FileWatcher::addPath(const QString &path, bool isDir, KDirWatch::WatchModes watchModes)
+{
+    WatchedPath *watched = m_paths.value(path);
+
+    if (!watched) {
+        watched = new WatchedPath(path, isDir, isDir && (watchModes & KDirWatch::WatchFiles), nullptr);
+        m_paths[path] = watched;
+
+        if (isDir) {
+            KDirWatch::self()->addDir(path, watchModes);
+        } else {
+            KDirWatch::self()->addFile(path);
+        }
+    }
+
+    watched->m_subscribers++;
+    return watched;
+}
+
+void FileWatcher::removePath(const QString &path)
+{
+    WatchedPath *watched = m_paths.value(path);
+
+    if (!watched) {
+        return;
+    }
+
+    watched->m_subscribers--;
+
+    if (watched->m_subscribers > 0) {
+        return;
+    }
+
+    m_paths.remove(path);
+
+    if (watched->m_isDir) {
+        KDirWatch::self()->removeDir(path);
+    } else {
+        KDirWatch::self()->removeFile(path);
+    }
+
+    watched->deleteLater();
+}
+
+void FileWatcher::onPathEvent(const QString &path)
+{
+    if (WatchedPath *watched = m_paths.value(path)) {
+        watched->addEvent(path);
+    }
+
+    //! files inside directories that are watched together with their files
+    WatchedPath *parentDir = m_paths.value(QFileInfo(path).absolutePath());
+
+    if (parentDir && parentDir->m_watchFiles) {
+        parentDir->addEvent(path);
+    }
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+// KDE
+#include <KDirWatch>
+
+namespace Latte {
+class FileWatcher;
+}
+
+namespace Latte {
+
+//! A watched file or directory. Bursts of changes, e.g. editors that save
+//! a file through many small writes, are delivered only once.
+class WatchedPath : public QObject
+{
+    Q_OBJECT
+
+public:
+    QString path() const;
+
+signals:
+    //! the path or a file of a watched directory was created or modified
+    void changed(const QString &path);
+    void deleted(const QString &path);
+
+private:
+    WatchedPath(const QString &path, bool isDir, bool watchFiles, QObject *parent);
+
+    void addEvent(const QString &path);
+    void flush();
+
+private:
+    bool m_isDir{false};
+    bool m_watchFiles{false};
+    int m_subscribers{0};
+
+    QString m_path;
+    QStringList m_pendingPaths;
+    QElapsedTimer m_pendingTime;
+    QTimer m_flushTimer;
+
+    friend class FileWatcher;
+};
+
+//! Single dispatcher of KDirWatch events. Subscribers connect to the
+//! WatchedPath of the path they are interested in, so a change is delivered
+//! only to the subscribers of that path instead of all KDirWatch listeners.
+class FileWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static FileWatcher *self();
+
+    //! the returned object is valid until all of its subscribers remove it
+    WatchedPath *addFile(const QString &file);
+    WatchedPath *addDir(const QString &dir, KDirWatch::WatchModes watchModes = KDirWatch::WatchDirOnly);
+
+    void removePath(const QString &path);
+
+private slots:
+    void onPathEvent(const QString &path);
+
+private:
+    FileWatcher(QObject *parent = nullptr);
+    ~FileWatcher() override;
+
+    WatchedPath *addPath(const QString &path, bool isDir, KDirWatch::WatchModes watchModes);
+
+private:
+    QHash<QString, WatchedPath *> m_paths;
+};
+
+}
+
+#endif
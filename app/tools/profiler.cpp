@@ -0,0 +1,182 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "profiler.h"
+
+// Qt
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+
+#define MAXEVENTS 200000
+
+namespace Latte {
+
+Profiler *Profiler::self()
+{
+    static Profiler profiler;
+    return &profiler;
+}
+
+Profiler::Profiler()
+{
+    m_clock.start();
+}
+
+bool Profiler::isEnabled() const
+{
+    return m_enabled.loadRelaxed() == 1;
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+    m_enabled.storeRelease(enabled ? 1 : 0);
+}
+
+qint64 Profiler::timestamp() const
+{
+    return m_clock.nsecsElapsed() / 1000;
+}
+
+void Profiler::appendEvent(const Event &event)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_events.count() < MAXEVENTS) {
+        m_events << event;
+        return;
+    }
+
+    m_events[m_nextEvent] = event;
+    m_nextEvent = (m_nextEvent + 1) % MAXEVENTS;
+    m_eventsWrapped = true;
+}
+
+void Profiler::addEvent(const char *category, const char *name, int viewId, qint64 start, qint64 duration)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    appendEvent({'X', category, name, viewId, start, duration});
+}
+
+void Profiler::increaseCounter(const char *name, int viewId)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    quint64 value{0};
+
+    {
+        QMutexLocker locker(&m_mutex);
+        const QByteArray key = QByteArray::number(viewId) + '\n' + name;
+        value = ++m_counters[key];
+    }
+
+    appendEvent({'C', "counters", name, viewId, timestamp(), static_cast<qint64>(value)});
+}
+
+void Profiler::setViewName(int viewId, const QString &name)
+{
+    QMutexLocker locker(&m_mutex);
+    m_viewNames[viewId] = name;
+}
+
+void Profiler::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_events.clear();
+    m_nextEvent = 0;
+    m_eventsWrapped = false;
+    m_counters.clear();
+}
+
+QByteArray Profiler::trace() const
+{
+    QVector<Event> recorded;
+    int nextEvent{0};
+    bool eventsWrapped{false};
+    QHash<int, QString> names;
+
+    {
+        //! only the shallow copies are made under the lock, render threads keep appending
+        //! events while the trace is serialized
+        QMutexLocker locker(&m_mutex);
+        recorded = m_events;
+        nextEvent = m_nextEvent;
+        eventsWrapped = m_eventsWrapped;
+        names = m_viewNames;
+    }
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QJsonArray events;
+
+    //! views are presented as threads of the process, 0 is used for global events
+    names[0] = QStringLiteral("Latte");
+
+    for (auto it = names.constBegin(); it != names.constEnd(); ++it) {
+        QJsonObject metadata;
+        metadata[QStringLiteral("ph")] = QStringLiteral("M");
+        metadata[QStringLiteral("name")] = QStringLiteral("thread_name");
+        metadata[QStringLiteral("pid")] = pid;
+        metadata[QStringLiteral("tid")] = it.key();
+        metadata[QStringLiteral("args")] = QJsonObject{{QStringLiteral("name"), it.value()}};
+        events << metadata;
+    }
+
+    const int count = recorded.count();
+    const int first = eventsWrapped ? nextEvent : 0;
+
+    for (int i = 0; i < count; ++i) {
+        const Event &event = recorded.at((first + i) % count);
+
+        QJsonObject json;
+        json[QStringLiteral("ph")] = QString(QLatin1Char(event.phase));
+        json[QStringLiteral("cat")] = QString::fromLatin1(event.category);
+        json[QStringLiteral("name")] = QString::fromLatin1(event.name);
+        json[QStringLiteral("pid")] = pid;
+        json[QStringLiteral("tid")] = event.viewId;
+        json[QStringLiteral("ts")] = event.start;
+
+        if (event.phase == 'C') {
+            json[QStringLiteral("args")] = QJsonObject{{QStringLiteral("value"), event.duration}};
+        } else {
+            json[QStringLiteral("dur")] = event.duration;
+        }
+
+        events << json;
+    }
+
+    QJsonObject root;
+    root[QStringLiteral("traceEvents")] = events;
+    root[QStringLiteral("displayTimeUnit")] = QStringLiteral("ms");
+
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+Profiler::Scope::Scope(const char *category, const char *name, int viewId)
+    : m_category(category),
+      m_name(name),
+      m_viewId(viewId)
+{
+    if (Profiler::self()->isEnabled()) {
+        m_start = Profiler::self()->timestamp();
+    }
+}
+
+Profiler::Scope::~Scope()
+{
+    if (m_start >= 0) {
+        Profiler *profiler = Profiler::self();
+        profiler->addEvent(m_category, m_name, m_viewId, m_start, profiler->timestamp() - m_start);
+        profiler->increaseCounter(m_name, m_viewId);
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Qt
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+namespace Latte {
+
+//! Records frame times and invocations of costly paths per view and exports
+//! them in Chrome trace format (chrome://tracing, Perfetto). It is disabled by
+//! default and it can be used from any thread. Event names and categories must
+//! be string literals because they are stored without copying them.
+class Profiler
+{
+public:
+    static Profiler *self();
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    //! microseconds since the profiler was created
+    qint64 timestamp() const;
+
+    void addEvent(const char *category, const char *name, int viewId, qint64 start, qint64 duration);
+    void increaseCounter(const char *name, int viewId);
+    void setViewName(int viewId, const QString &name);
+
+    void clear();
+    QByteArray trace() const;
+
+    //! records the duration of the current scope
+    class Scope
+    {
+    public:
+        Scope(const char *category, const char *name, int viewId = 0);
+        ~Scope();
+
+    private:
+        const char *m_category;
+        const char *m_name;
+        int m_viewId;
+        qint64 m_start{-1};
+    };
+
+private:
+    Profiler();
+
+    struct Event {
+        char phase;
+        const char *category;
+        const char *name;
+        int viewId;
+        qint64 start;
+        qint64 duration; //! value for counter events
+    };
+
+    void appendEvent(const Event &event);
+
+private:
+    QAtomicInt m_enabled{0};
+    QElapsedTimer m_clock;
+
+    mutable QMutex m_mutex;
+    //! ring buffer of the most recent events
+    QVector<Event> m_events;
+    int m_nextEvent{0};
+    bool m_eventsWrapped{false};
+
+    QHash<QByteArray, quint64> m_counters;
+    QHash<int, QString> m_viewNames;
+};
+
+}
+
+#endif
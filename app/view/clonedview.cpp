@@ -74,14 +74,14 @@ void ClonedView::initSync()
     });
 
     //! Update Applets and Containment from OrigalView -> Clone
-    connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::containmentConfigPropertyChanged, this, &ClonedView::updateContainmentConfigProperty);
-    connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletConfigPropertyChanged, this, &ClonedView::onOriginalAppletConfigPropertyChanged);
+    //! containment and applets config changes are propagated from OriginalView::syncConfigToClones()
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletInScheduledDestructionChanged, this, &ClonedView::onOriginalAppletInScheduledDestructionChanged);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletRemoved, this, &ClonedView::onOriginalAppletRemoved);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletsOrderChanged, this, &ClonedView::onOriginalAppletsOrderChanged);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletsInLockedZoomChanged, this, &ClonedView::onOriginalAppletsInLockedZoomChanged);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletsDisabledColoringChanged, this, &ClonedView::onOriginalAppletsDisabledColoringChanged);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletDataCreated, this, &ClonedView::updateAppletIdsHash);
+    connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletTasksModelChanged, this, &ClonedView::onOriginalAppletTasksModelChanged);
     connect(m_originalView->extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletCreated, this->extendedInterface(), [&](const QString &pluginId) {
         extendedInterface()->addApplet(pluginId);
     });
@@ -139,16 +139,7 @@ bool ClonedView::hasOriginalAppletId(const int &clonedid)
         return false;
     }
 
-    QHash<int, int>::const_iterator i = m_currentAppletIds.constBegin();
-    while (i != m_currentAppletIds.constEnd()) {
-        if (i.value() == clonedid) {
-            return true;
-        }
-
-        ++i;
-    }
-
-    return false;
+    return m_originalAppletIds.contains(clonedid);
 }
 
 int ClonedView::originalAppletId(const int &clonedid)
@@ -157,16 +148,7 @@ int ClonedView::originalAppletId(const int &clonedid)
         return -1;
     }
 
-    QHash<int, int>::const_iterator i = m_currentAppletIds.constBegin();
-    while (i != m_currentAppletIds.constEnd()) {
-        if (i.value() == clonedid) {
-            return i.key();
-        }
-
-        ++i;
-    }
-
-    return -1;
+    return m_originalAppletIds.value(clonedid, -1);
 }
 
 
@@ -193,8 +175,19 @@ Latte::Data::View ClonedView::data() const
     return vdata;
 }
 
+QObject *ClonedView::sharedTasksModel(const int &appletId) const
+{
+    if (!m_originalView || !m_originalAppletIds.contains(appletId)) {
+        return nullptr;
+    }
+
+    return m_originalView->extendedInterface()->appletTasksModel(m_originalAppletIds[appletId]);
+}
+
 void ClonedView::updateAppletIdsHash()
 {
+    bool idsadded{false};
+
     QList<int> originalids = m_originalView->extendedInterface()->appletsOrder();
     QList<int> clonedids = extendedInterface()->appletsOrder();
 
@@ -212,8 +205,14 @@ void ClonedView::updateAppletIdsHash()
 
         if (originalapplet.id>0 && clonedapplet.id>0 && originalapplet.plugin == clonedapplet.plugin && !registeredclonedid) {
             m_currentAppletIds[originalapplet.id] = clonedapplet.id;
+            m_originalAppletIds[clonedapplet.id] = originalapplet.id;
+            idsadded = true;
         }
     }
+
+    if (idsadded) {
+        emit sharedTasksModelsChanged();
+    }
 }
 
 QList<int> ClonedView::translateToClonesOrder(const QList<int> &originalIds)
@@ -255,16 +254,36 @@ void ClonedView::onOriginalAppletRemoved(const int &id)
     }
 
     extendedInterface()->removeApplet(m_currentAppletIds[id]);
+    m_originalAppletIds.remove(m_currentAppletIds[id]);
     m_currentAppletIds.remove(id);
+
+    emit sharedTasksModelsChanged();
 }
 
-void ClonedView::onOriginalAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value)
+void ClonedView::onOriginalAppletTasksModelChanged(const int &id)
 {
-    if (!m_currentAppletIds.contains(id)) {
-        return;
+    if (m_currentAppletIds.contains(id)) {
+        emit sharedTasksModelsChanged();
     }
+}
 
-    extendedInterface()->updateAppletConfigProperty(m_currentAppletIds[id], key, value);
+void ClonedView::syncOriginalConfig(const QHash<QString, QVariant> &containmentValues, const QHash<int, QHash<QString, QVariant>> &appletsValues)
+{
+    if (!containmentValues.isEmpty()) {
+        QHash<QString, QVariant> values = containmentValues;
+
+        for (const auto &key : CONTAINMENTMANUALSYNCEDPROPERTIES) {
+            values.remove(key);
+        }
+
+        extendedInterface()->updateContainmentConfigProperties(values);
+    }
+
+    for (auto it = appletsValues.constBegin(); it != appletsValues.constEnd(); ++it) {
+        if (m_currentAppletIds.contains(it.key())) {
+            extendedInterface()->updateAppletConfigProperties(m_currentAppletIds[it.key()], it.value());
+        }
+    }
 }
 
 void ClonedView::onOriginalAppletInScheduledDestructionChanged(const int &id, const bool &enabled)
@@ -276,15 +295,6 @@ void ClonedView::onOriginalAppletInScheduledDestructionChanged(const int &id, co
     extendedInterface()->setAppletInScheduledDestruction(m_currentAppletIds[id], enabled);
 }
 
-void ClonedView::updateContainmentConfigProperty(const QString &key, const QVariant &value)
-{
-    if (!CONTAINMENTMANUALSYNCEDPROPERTIES.contains(key)) {
-        extendedInterface()->updateContainmentConfigProperty(key, value);
-    } else {
-        //qDebug() << "org.kde.sync :: containment config value syncing blocked :: " << key;
-    }
-}
-
 void ClonedView::updateOriginalAppletConfigProperty(const int &clonedid, const QString &key, const QVariant &value)
 {
     if (!hasOriginalAppletId(clonedid)) {
@@ -36,19 +36,23 @@ public:
     ViewPart::Indicator *indicator() const override;
     Latte::Data::View data() const override;
 
+    QObject *sharedTasksModel(const int &appletId) const override;
+
+    //! original config changes, they are applied together
+    void syncOriginalConfig(const QHash<QString, QVariant> &containmentValues, const QHash<int, QHash<QString, QVariant>> &appletsValues);
+
 protected:
     void showConfigurationInterface(Plasma::Applet *applet) override;
 
 private slots:
     void initSync();
-    void onOriginalAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value);
     void onOriginalAppletInScheduledDestructionChanged(const int &id, const bool &enabled);
     void onOriginalAppletRemoved(const int &id);
     void onOriginalAppletsOrderChanged();
     void onOriginalAppletsInLockedZoomChanged(const QList<int> &originalapplets);
     void onOriginalAppletsDisabledColoringChanged(const QList<int> &originalapplets);
+    void onOriginalAppletTasksModelChanged(const int &id);
 
-    void updateContainmentConfigProperty(const QString &key, const QVariant &value);
     void updateOriginalAppletConfigProperty(const int &clonedid, const QString &key, const QVariant &value);
 
     void updateAppletIdsHash();
@@ -64,7 +68,10 @@ private:
     static QStringList CONTAINMENTMANUALSYNCEDPROPERTIES;
 
     QPointer<Latte::OriginalView> m_originalView;
+    //! original applet id -> cloned applet id
     QHash<int, int> m_currentAppletIds;
+    //! cloned applet id -> original applet id
+    QHash<int, int> m_originalAppletIds;
 };
 
 }
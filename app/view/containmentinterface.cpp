@@ -48,6 +48,10 @@ ContainmentInterface::ContainmentInterface(Latte::View *parent)
     m_appletDelayedConfigurationTimer.setSingleShot(true);
     connect(&m_appletDelayedConfigurationTimer, &QTimer::timeout, this, &ContainmentInterface::updateAppletDelayedConfiguration);
 
+    m_mirroredConfigurationsWriteTimer.setInterval(1000);
+    m_mirroredConfigurationsWriteTimer.setSingleShot(true);
+    connect(&m_mirroredConfigurationsWriteTimer, &QTimer::timeout, this, &ContainmentInterface::writeMirroredConfigurations);
+
     connect(&m_appletsExpandedConnectionsTimer, &QTimer::timeout, this, &ContainmentInterface::updateAppletsTracking);
 
     connect(m_view, &View::containmentChanged
@@ -64,6 +68,7 @@ ContainmentInterface::ContainmentInterface(Latte::View *parent)
 
 ContainmentInterface::~ContainmentInterface()
 {
+    writeMirroredConfigurations();
 }
 
 void ContainmentInterface::identifyShortcutsHost()
@@ -200,45 +205,50 @@ bool ContainmentInterface::updateBadgeForLatteTask(const QString identifier, con
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
+    bool updated{false};
 
-    for (auto *applet : applets) {
-        KPluginMetaData meta = applet->kPackage().metadata();
+    for (auto *plasmoid : m_latteTasksModel->tasks()) {
+        if (!m_badgeHosts.value(plasmoid)) {
+            resolveBadgeMethod(plasmoid);
+        }
 
-        if (meta.pluginId() == QLatin1String("org.kde.latte.plasmoid")) {
+        QQuickItem *host = m_badgeHosts.value(plasmoid);
 
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
+        if (host && m_badgeMethods[plasmoid].invoke(host, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
+            updated = true;
+        }
+    }
 
-                if (childItems.isEmpty()) {
-                    continue;
-                }
+    return updated;
+}
 
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        // not using QMetaObject::invokeMethod to avoid warnings when calling
-                        // this on applets that don't have it or other child items since this
-                        // is pretty much trial and error.
-                        // Also, "var" arguments are treated as QVariant in QMetaObject
+void ContainmentInterface::resolveBadgeMethod(PlasmaQuick::AppletQuickItem *plasmoid)
+{
+    m_badgeHosts.remove(plasmoid);
+    m_badgeMethods.remove(plasmoid);
 
-                        int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
+    if (!plasmoid) {
+        return;
+    }
 
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+    for (QQuickItem *item : plasmoid->childItems()) {
+        if (auto *metaObject = item->metaObject()) {
+            // not using QMetaObject::invokeMethod to avoid warnings when calling
+            // this on applets that don't have it or other child items since this
+            // is pretty much trial and error.
+            // Also, "var" arguments are treated as QVariant in QMetaObject
 
-                        QMetaMethod method = metaObject->method(methodIndex);
+            int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
 
-                        if (method.invoke(item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
-                            return true;
-                        }
-                    }
-                }
+            if (methodIndex == -1) {
+                continue;
             }
+
+            m_badgeHosts[plasmoid] = item;
+            m_badgeMethods[plasmoid] = metaObject->method(methodIndex);
+            return;
         }
     }
-
-    return false;
 }
 
 bool ContainmentInterface::activatePlasmaTask(const int index)
@@ -679,6 +689,35 @@ QAbstractListModel *ContainmentInterface::plasmaTasksModel() const
     return m_plasmaTasksModel;
 }
 
+QObject *ContainmentInterface::appletTasksModel(const int &id) const
+{
+    return m_appletTasksModels.value(id);
+}
+
+void ContainmentInterface::setAppletTasksModel(const int &id, QObject *model)
+{
+    if (m_appletTasksModels.value(id) == model) {
+        return;
+    }
+
+    if (!model) {
+        m_appletTasksModels.remove(id);
+        emit appletTasksModelChanged(id);
+        return;
+    }
+
+    m_appletTasksModels[id] = model;
+
+    connect(model, &QObject::destroyed, this, [&, id]() {
+        if (m_appletTasksModels.contains(id) && !m_appletTasksModels[id]) {
+            m_appletTasksModels.remove(id);
+            emit appletTasksModelChanged(id);
+        }
+    });
+
+    emit appletTasksModelChanged(id);
+}
+
 void ContainmentInterface::onAppletExpandedChanged()
 {
     PlasmaQuick::AppletQuickItem *appletItem = static_cast<PlasmaQuick::AppletQuickItem *>(QObject::sender());
@@ -881,6 +920,65 @@ void ContainmentInterface::updateAppletConfigProperty(const int &id, const QStri
     }
 }
 
+void ContainmentInterface::updateContainmentConfigProperties(const QHash<QString, QVariant> &values)
+{
+    updateConfigProperties(m_configuration, values);
+}
+
+void ContainmentInterface::updateAppletConfigProperties(const int &id, const QHash<QString, QVariant> &values)
+{
+    if (!m_appletData.contains(id)) {
+        return;
+    }
+
+    updateConfigProperties(m_appletData[id].configuration, values);
+}
+
+void ContainmentInterface::updateConfigProperties(KDeclarative::ConfigPropertyMap *configuration, const QHash<QString, QVariant> &values)
+{
+    if (!configuration || values.isEmpty()) {
+        return;
+    }
+
+    const QStringList keys = configuration->keys();
+    bool autosave = configuration->isAutoSave();
+    bool changed{false};
+
+    //! values are stored in memory only, otherwise each value would write the config file
+    configuration->setAutoSave(false);
+
+    for (auto it = values.constBegin(); it != values.constEnd(); ++it) {
+        if (keys.contains(it.key()) && (*configuration)[it.key()] != it.value()) {
+            configuration->insert(it.key(), it.value());
+            emit configuration->valueChanged(it.key(), it.value());
+            changed = true;
+        }
+    }
+
+    configuration->setAutoSave(autosave);
+
+    if (changed && autosave) {
+        if (!m_mirroredConfigurations.contains(configuration)) {
+            m_mirroredConfigurations << configuration;
+        }
+
+        m_mirroredConfigurationsWriteTimer.start();
+    }
+}
+
+void ContainmentInterface::writeMirroredConfigurations()
+{
+    m_mirroredConfigurationsWriteTimer.stop();
+
+    for (const auto &configuration : m_mirroredConfigurations) {
+        if (configuration) {
+            configuration->writeConfig();
+        }
+    }
+
+    m_mirroredConfigurations.clear();
+}
+
 void ContainmentInterface::updateAppletsTracking()
 {
     if (!m_view->containment()) {
@@ -999,6 +1097,11 @@ void ContainmentInterface::onAppletAdded(Plasma::Applet *applet)
         if (meta.pluginId() == QLatin1String("org.kde.latte.plasmoid")) {
             //! populate latte tasks applet
             m_latteTasksModel->addTask(ai);
+
+            connect(ai, &QObject::destroyed, this, [&, ai](){
+                m_badgeHosts.remove(ai);
+                m_badgeMethods.remove(ai);
+            });
         } else if (provides.contains(QLatin1String("org.kde.plasma.multitasking"))) {
             //! populate plasma tasks applet
             m_plasmaTasksModel->addTask(ai);
@@ -1045,6 +1148,11 @@ void ContainmentInterface::onAppletAdded(Plasma::Applet *applet)
                 emit appletRemoved(data.id);
                 //qDebug() << "org.kde.sync: removing applet ::: " << data.id << " __ " << data.plugin << " remained : " << m_appletData.keys();
                 m_appletData.remove(data.id);
+
+                if (m_appletTasksModels.contains(data.id)) {
+                    m_appletTasksModels.remove(data.id);
+                    emit appletTasksModelChanged(data.id);
+                }
             });
         }
 
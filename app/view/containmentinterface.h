@@ -116,6 +116,10 @@ public slots:
 
     Q_INVOKABLE bool isApplication(const QUrl &url) const;
 
+    //! tasks models published from latte tasks plasmoids in order to be shared with cloned views
+    Q_INVOKABLE QObject *appletTasksModel(const int &id) const;
+    Q_INVOKABLE void setAppletTasksModel(const int &id, QObject *model);
+
     void addApplet(const QString &pluginId);
     void addApplet(QObject *metadata, int x, int y);
     void removeApplet(const int &id);
@@ -125,6 +129,9 @@ public slots:
     void setAppletInScheduledDestruction(const int &id, const bool &enabled);
     void updateContainmentConfigProperty(const QString &key, const QVariant &value);
     void updateAppletConfigProperty(const int &id, const QString &key, const QVariant &value);    
+    //! mirrored values are applied together and they are written when they settle
+    void updateContainmentConfigProperties(const QHash<QString, QVariant> &values);
+    void updateAppletConfigProperties(const int &id, const QHash<QString, QVariant> &values);
 
 signals:
     void expandedAppletStateChanged();
@@ -139,6 +146,7 @@ signals:
 
     //! syncing signals
     void appletRemoved(const int &id);
+    void appletTasksModelChanged(const int &id);
 
     void appletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value);
     void appletCreated(const QString &pluginId);
@@ -161,6 +169,7 @@ private slots:
     void updateAppletsDisabledColoring();
     void updateAppletsTracking();
     void updateAppletDelayedConfiguration();
+    void writeMirroredConfigurations();
 
     void onAppletAdded(Plasma::Applet *applet);
     void onAppletExpandedChanged();
@@ -169,8 +178,10 @@ private slots:
 
 private:
     void addExpandedApplet(PlasmaQuick::AppletQuickItem * appletQuickItem);
+    void resolveBadgeMethod(PlasmaQuick::AppletQuickItem *plasmoid);
     void removeExpandedApplet(PlasmaQuick::AppletQuickItem *appletQuickItem);
     void initAppletConfigurationSignals(const int &id, KDeclarative::ConfigPropertyMap *configuration);
+    void updateConfigProperties(KDeclarative::ConfigPropertyMap *configuration, const QHash<QString, QVariant> &values);
 
     bool appletIsExpandable(PlasmaQuick::AppletQuickItem *appletQuickItem) const;
 
@@ -207,12 +218,21 @@ private:
     QHash<PlasmaQuick::AppletQuickItem *, int> m_expandedAppletIds;
     QHash<PlasmaQuick::AppletQuickItem *, QMetaObject::Connection> m_appletsExpandedConnections;
 
+    //!resolved updateBadge(QVariant,QVariant) handles for latte tasks plasmoids
+    QHash<PlasmaQuick::AppletQuickItem *, QPointer<QQuickItem>> m_badgeHosts;
+    QHash<PlasmaQuick::AppletQuickItem *, QMetaMethod> m_badgeMethods;
+
     //!all applet data
     QList<int> m_appletOrder; //includes justify splitters
     QList<int> m_appletsInLockedZoom;
     QList<int> m_appletsDisabledColoring;
     QHash<int, ViewPart::AppletInterfaceData> m_appletData;
+    QHash<int, QPointer<QObject>> m_appletTasksModels;
     QTimer m_appletDelayedConfigurationTimer;
+
+    //! configurations that were updated from mirrored values and have not been written yet
+    QList<QPointer<KDeclarative::ConfigPropertyMap>> m_mirroredConfigurations;
+    QTimer m_mirroredConfigurationsWriteTimer;
 };
 
 }
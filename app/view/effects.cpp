@@ -11,6 +11,7 @@
 #include "panelshadows_p.h"
 #include "view.h"
 #include "../lattecorona.h"
+#include "../tools/profiler.h"
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
@@ -20,6 +21,9 @@
 #include <KWindowEffects>
 #include <KWindowSystem>
 
+#define PENDINGUPDATESMAXDELAY 50
+#define CUSTOMMASKCACHESIZE 64
+
 
 namespace Latte {
 namespace ViewPart {
@@ -39,28 +43,36 @@ Effects::~Effects()
 
 void Effects::init()
 {
-    connect(this, &Effects::backgroundOpacityChanged, this, &Effects::updateEffects);
+    //! effects and mask regions are recomputed at most once per rendered frame,
+    //! the timer is used only when the view does not render any frame
+    m_pendingUpdatesTimer.setInterval(PENDINGUPDATESMAXDELAY);
+    m_pendingUpdatesTimer.setSingleShot(true);
+    connect(&m_pendingUpdatesTimer, &QTimer::timeout, this, &Effects::flushPendingUpdates);
+    connect(m_view, &QQuickWindow::afterAnimating, this, &Effects::flushPendingUpdates);
+
+    connect(this, &Effects::backgroundOpacityChanged, this, &Effects::scheduleEffectsUpdate);
     connect(this, &Effects::backgroundOpacityChanged, this, &Effects::updateBackgroundContrastValues);
-    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::drawEffectsChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::enabledBordersChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::rectChanged, this, &Effects::updateEffects);
-
-
-    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::updateMask);
-    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::updateMask);
-    connect(this, &Effects::subtractedMaskRegionsChanged, this, &Effects::updateMask);
-    connect(this, &Effects::unitedMaskRegionsChanged, this, &Effects::updateMask);
-    connect(m_view, &QQuickWindow::widthChanged, this, &Effects::updateMask);
-    connect(m_view, &QQuickWindow::heightChanged, this, &Effects::updateMask);
-    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::updateMask);
+    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::clearCustomMaskCache);
+    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::scheduleEffectsUpdate);
+    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::scheduleEffectsUpdate);
+    connect(this, &Effects::drawEffectsChanged, this, &Effects::scheduleEffectsUpdate);
+    connect(this, &Effects::enabledBordersChanged, this, &Effects::scheduleEffectsUpdate);
+    connect(this, &Effects::rectChanged, this, &Effects::scheduleEffectsUpdate);
+
+
+    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::scheduleMaskUpdate);
+    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::scheduleMaskUpdate);
+    connect(this, &Effects::subtractedMaskRegionsChanged, this, &Effects::scheduleMaskUpdate);
+    connect(this, &Effects::unitedMaskRegionsChanged, this, &Effects::scheduleMaskUpdate);
+    connect(m_view, &QQuickWindow::widthChanged, this, &Effects::scheduleMaskUpdate);
+    connect(m_view, &QQuickWindow::heightChanged, this, &Effects::scheduleMaskUpdate);
+    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::scheduleMaskUpdate);
     connect(KWindowSystem::self(), &KWindowSystem::compositingChanged, this, [&]() {
         if (!KWindowSystem::compositingActive() && !m_view->behaveAsPlasmaPanel()) {
             setMask(m_rect);
         }
 
-        updateMask();
+        scheduleMaskUpdate();
     });
 
     connect(this, &Effects::rectChanged, this, [&]() {
@@ -85,15 +97,15 @@ void Effects::init()
     connect(m_view, &Latte::View::maxLengthChanged, this, &Effects::updateEnabledBorders);
     connect(m_view, &Latte::View::offsetChanged, this, &Effects::updateEnabledBorders);
     connect(m_view, &Latte::View::screenEdgeMarginEnabledChanged, this, &Effects::updateEnabledBorders);
-    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::updateEffects);
+    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::scheduleEffectsUpdate);
     connect(this, &Effects::drawShadowsChanged, this, &Effects::updateShadows);
     connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::updateShadows);
-    connect(m_view, &Latte::View::configWindowGeometryChanged, this, &Effects::updateMask);
+    connect(m_view, &Latte::View::configWindowGeometryChanged, this, &Effects::scheduleMaskUpdate);
     connect(m_view, &Latte::View::layoutChanged, this, &Effects::onPopUpMarginChanged);
 
     connect(&m_theme, &Plasma::Theme::themeChanged, this, [&]() {
         updateBackgroundContrastValues();
-        updateEffects();
+        scheduleEffectsUpdate();
     });
 }
 
@@ -288,7 +300,7 @@ void Effects::setMask(QRect area)
         return;
 
     m_mask = area;
-    updateMask();
+    scheduleMaskUpdate();
 
     // qDebug() << "dock mask set:" << m_mask;
     emit maskChanged();
@@ -408,36 +420,104 @@ void Effects::removeUnitedMaskRegion(const QString &regionid)
     emit unitedMaskRegionsChanged();
 }
 
+void Effects::scheduleEffectsUpdate()
+{
+    m_effectsUpdatePending = true;
+    requestPendingUpdates();
+}
+
+void Effects::scheduleMaskUpdate()
+{
+    m_maskUpdatePending = true;
+    requestPendingUpdates();
+}
+
+void Effects::requestPendingUpdates()
+{
+    //! idle views do not request frames only for the effects, they are
+    //! applied with the next frame or through the fallback timer
+    const bool idle = m_view->renderGovernor() && (m_view->renderGovernor()->isIdle() || m_view->renderGovernor()->isSuspended());
+
+    if (m_view->isExposed() && !idle) {
+        m_view->update();
+    }
+
+    if (!m_pendingUpdatesTimer.isActive()) {
+        m_pendingUpdatesTimer.start();
+    }
+}
+
+void Effects::flushPendingUpdates()
+{
+    if (!m_effectsUpdatePending && !m_maskUpdatePending) {
+        return;
+    }
+
+    m_pendingUpdatesTimer.stop();
+
+    if (m_effectsUpdatePending) {
+        m_effectsUpdatePending = false;
+        updateEffects();
+    }
+
+    if (m_maskUpdatePending) {
+        m_maskUpdatePending = false;
+        updateMask();
+    }
+}
+
+void Effects::clearCustomMaskCache()
+{
+    m_customMaskCache.clear();
+}
+
 QRegion Effects::customMask(const QRect &rect)
 {
-    QRegion result = rect;
-    int dx = rect.right() - m_cornersMaskRegion.topLeft.boundingRect().width() + 1;
-    int dy = rect.bottom() - m_cornersMaskRegion.topLeft.boundingRect().height() + 1;
+    //! the same sizes are requested repeatedly during animations
+    const quint64 corners = (m_hasTopLeftCorner ? 1 : 0) | (m_hasTopRightCorner ? 2 : 0)
+            | (m_hasBottomLeftCorner ? 4 : 0) | (m_hasBottomRightCorner ? 8 : 0);
+    const quint64 key = (quint64(quint32(rect.width())) << 36) | (quint64(quint32(rect.height()) & 0xFFFFFFF) << 4) | corners;
+
+    if (m_customMaskCache.contains(key)) {
+        QRegion cached = m_customMaskCache[key];
+        cached.translate(rect.x(), rect.y());
+        return cached;
+    }
+
+    QRegion result = QRect(0, 0, rect.width(), rect.height());
+    int dx = rect.width() - m_cornersMaskRegion.topLeft.boundingRect().width();
+    int dy = rect.height() - m_cornersMaskRegion.topLeft.boundingRect().height();
 
     if (m_hasTopLeftCorner) {
         QRegion tl = m_cornersMaskRegion.topLeft;
-        tl.translate(rect.x(), rect.y());
         result = result.subtracted(tl);
     }
 
     if (m_hasTopRightCorner) {
         QRegion tr = m_cornersMaskRegion.topRight;
-        tr.translate(rect.x() + dx, rect.y());
+        tr.translate(dx, 0);
         result = result.subtracted(tr);
     }
 
     if (m_hasBottomRightCorner) {
         QRegion br = m_cornersMaskRegion.bottomRight;
-        br.translate(rect.x() + dx, rect.y() + dy);
+        br.translate(dx, dy);
         result = result.subtracted(br);
     }
 
     if (m_hasBottomLeftCorner) {
         QRegion bl = m_cornersMaskRegion.bottomLeft;
-        bl.translate(rect.x(), rect.y() + dy);
+        bl.translate(0, dy);
         result = result.subtracted(bl);
     }
 
+    if (m_customMaskCache.count() >= CUSTOMMASKCACHESIZE) {
+        m_customMaskCache.clear();
+    }
+
+    m_customMaskCache[key] = result;
+    result.translate(rect.x(), rect.y());
+
     return result;
 }
 
@@ -533,6 +613,8 @@ void Effects::updateShadows()
 
 void Effects::updateEffects()
 {
+    Profiler::Scope profilerScope("effects", "updateEffects", m_view->renderGovernor() ? m_view->renderGovernor()->viewId() : 0);
+
     //! Don't apply any effect before the wayland surface is created under wayland
     //! https://bugs.kde.org/show_bug.cgi?id=392890
     if (KWindowSystem::isPlatformWayland() && !m_view->surface()) {
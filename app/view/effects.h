@@ -14,6 +14,7 @@
 #include <QPointer>
 #include <QQuickView>
 #include <QRect>
+#include <QTimer>
 
 // Plasma
 #include <Plasma/FrameSvg>
@@ -150,12 +151,19 @@ private slots:
     void updateBackgroundContrastValues();
     void updateBackgroundCorners();
 
+    void clearCustomMaskCache();
+    void flushPendingUpdates();
+    void scheduleEffectsUpdate();
+    void scheduleMaskUpdate();
+
 private:
     bool backgroundRadiusIsEnabled() const;
     qreal currentMidValue(const qreal &max, const qreal &factor, const qreal &min) const;
     QRegion customMask(const QRect &rect);
     QRegion maskCombinedRegion();
 
+    void requestPendingUpdates();
+
 private:
     bool m_animationsBlocked{false};
     bool m_backgroundAllCorners{false};
@@ -201,6 +209,14 @@ private:
     //! Subtracted and United Mask regions
     QHash<QString, QRegion> m_subtractedMaskRegions;
     QHash<QString, QRegion> m_unitedMaskRegions;
+
+    //! effects and mask regions that must be recomputed for the next frame
+    bool m_effectsUpdatePending{false};
+    bool m_maskUpdatePending{false};
+    QTimer m_pendingUpdatesTimer;
+
+    //! size and corners -> custom mask at (0,0)
+    QHash<quint64, QRegion> m_customMaskCache;
 };
 
 }
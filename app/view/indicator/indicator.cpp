@@ -67,8 +67,9 @@ Indicator::~Indicator()
 {
     unloadIndicators();
 
-    if (m_component) {
-        m_component->deleteLater();
+    if (m_corona) {
+        m_corona->indicatorFactory()->releaseComponent(m_component);
+        m_corona->indicatorFactory()->releaseComponent(m_plasmaComponent);
     }
 
     if (m_configLoader) {
@@ -271,11 +272,13 @@ void Indicator::updateComponent()
 
     if (!uiPath.isEmpty()) {
         uiPath = m_pluginPath + "/package/" + uiPath;
-        m_component = new QQmlComponent(m_view->engine(), uiPath);
+        m_component = m_corona->indicatorFactory()->acquireComponent(m_view->engine(), uiPath);
+    } else {
+        m_component = nullptr;
     }
 
     if (prevComponent) {
-        prevComponent->deleteLater();
+        m_corona->indicatorFactory()->releaseComponent(prevComponent);
     }
 }
 
@@ -288,11 +291,13 @@ void Indicator::loadPlasmaComponent()
 
     if (!uiPath.isEmpty()) {
         uiPath = QFileInfo(metadata.fileName()).absolutePath() + "/package/" + uiPath;
-        m_plasmaComponent = new QQmlComponent(m_view->engine(), uiPath);
+        m_plasmaComponent = m_corona->indicatorFactory()->acquireComponent(m_view->engine(), uiPath);
+    } else {
+        m_plasmaComponent = nullptr;
     }
 
     if (prevComponent) {
-        prevComponent->deleteLater();
+        m_corona->indicatorFactory()->releaseComponent(prevComponent);
     }
 
     emit plasmaComponentChanged();
@@ -29,6 +29,13 @@ OriginalView::OriginalView(Plasma::Corona *corona, QScreen *targetScreen, bool b
     connect(this, &View::layoutChanged, this, &OriginalView::syncClonesToScreens);
     connect(this, &OriginalView::screensGroupChanged, this, &OriginalView::syncClonesToScreens);
     connect(this, &OriginalView::screensGroupChanged, this, &OriginalView::saveConfig);
+
+    m_clonesConfigSyncTimer.setInterval(0);
+    m_clonesConfigSyncTimer.setSingleShot(true);
+    connect(&m_clonesConfigSyncTimer, &QTimer::timeout, this, &OriginalView::syncConfigToClones);
+
+    connect(extendedInterface(), &Latte::ViewPart::ContainmentInterface::containmentConfigPropertyChanged, this, &OriginalView::onContainmentConfigPropertyChanged);
+    connect(extendedInterface(), &Latte::ViewPart::ContainmentInterface::appletConfigPropertyChanged, this, &OriginalView::onAppletConfigPropertyChanged);
 }
 
 OriginalView::~OriginalView()
@@ -205,6 +212,40 @@ void OriginalView::addApplet(QObject *mimedata, const int &x, const int &y, cons
     }
 }
 
+void OriginalView::onContainmentConfigPropertyChanged(const QString &key, const QVariant &value)
+{
+    if (m_clones.isEmpty()) {
+        return;
+    }
+
+    m_pendingContainmentConfig[key] = value;
+    m_clonesConfigSyncTimer.start();
+}
+
+void OriginalView::onAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value)
+{
+    if (m_clones.isEmpty()) {
+        return;
+    }
+
+    m_pendingAppletsConfig[id][key] = value;
+    m_clonesConfigSyncTimer.start();
+}
+
+void OriginalView::syncConfigToClones()
+{
+    //! only the last value of each key is propagated
+    const QHash<QString, QVariant> containmentValues = m_pendingContainmentConfig;
+    const QHash<int, QHash<QString, QVariant>> appletsValues = m_pendingAppletsConfig;
+
+    m_pendingContainmentConfig.clear();
+    m_pendingAppletsConfig.clear();
+
+    for (const auto clone : m_clones) {
+        clone->syncOriginalConfig(containmentValues, appletsValues);
+    }
+}
+
 void OriginalView::syncClonesToScreens()
 {
     if (isSingle() || (containment() && containment()->destroyed())) {
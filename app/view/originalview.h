@@ -11,7 +11,10 @@
 #include "view.h"
 
 // Qt
+#include <QHash>
 #include <QList>
+#include <QTimer>
+#include <QVariant>
 
 namespace Latte {
 
@@ -52,6 +55,10 @@ signals:
 
 private slots:    
     void syncClonesToScreens();
+    void syncConfigToClones();
+
+    void onContainmentConfigPropertyChanged(const QString &key, const QVariant &value);
+    void onAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value);
 
     void restoreConfig();
     void saveConfig();
@@ -65,6 +72,12 @@ private:
     QList<Latte::ClonedView *> m_clones;
 
     QList<int> m_waitingCreation;
+
+    //! config changes that have not been propagated to clones yet,
+    //! they are collected per event loop turn
+    QHash<QString, QVariant> m_pendingContainmentConfig;
+    QHash<int, QHash<QString, QVariant>> m_pendingAppletsConfig;
+    QTimer m_clonesConfigSyncTimer;
 };
 
 }
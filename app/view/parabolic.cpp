@@ -67,6 +67,10 @@ void Parabolic::onEvent(QEvent *e)
         setCurrentParabolicItem(nullptr);
         break;
     case QEvent::MouseMove:
+        if (m_view->renderGovernor()) {
+            m_view->renderGovernor()->markParabolicEvent();
+        }
+
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (m_currentParabolicItem) {
                 QPointF internal = m_currentParabolicItem->mapFromScene(me->windowPos());
@@ -17,6 +17,7 @@
 #include "../layout/centrallayout.h"
 #include "../layouts/manager.h"
 #include "../settings/universalsettings.h"
+#include "../tools/profiler.h"
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
@@ -498,6 +499,8 @@ void Positioner::syncGeometry()
 
 void Positioner::immediateSyncGeometry()
 {
+    Profiler::Scope profilerScope("geometry", "immediateSyncGeometry", m_view->renderGovernor() ? m_view->renderGovernor()->viewId() : 0);
+
     bool found{false};
 
     qDebug() << "immediateSyncGeometry() called...";
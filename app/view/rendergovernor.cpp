@@ -0,0 +1,310 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "rendergovernor.h"
+
+// local
+#include "positioner.h"
+#include "view.h"
+#include "visibilitymanager.h"
+#include "../tools/profiler.h"
+
+// Qt
+#include <QDebug>
+
+// Plasma
+#include <Plasma/Containment>
+
+// KDE
+#include <KWindowSystem>
+
+#define FRAMESCOUNTERINTERVAL 1000
+
+namespace Latte {
+namespace ViewPart {
+
+RenderGovernor::RenderGovernor(Latte::View *parent)
+    : QObject(parent),
+      m_frameState(new FrameState),
+      m_view(parent)
+{
+    m_framesTimer.setInterval(FRAMESCOUNTERINTERVAL);
+    connect(&m_framesTimer, &QTimer::timeout, this, &RenderGovernor::updateFramesPerSecond);
+
+    //! beforeRendering and frameSwapped are sent from the render thread, they access
+    //! only the shared frame state and never the governor itself
+    QSharedPointer<FrameState> state = m_frameState;
+
+    connect(m_view, &QQuickWindow::beforeRendering, this, [state]() {
+        onBeforeRendering(state.data());
+    }, Qt::DirectConnection);
+    connect(m_view, &QQuickWindow::frameSwapped, this, [state]() {
+        onFrameSwapped(state.data());
+    }, Qt::DirectConnection);
+
+    //! sent from the gui thread for every frame that is going to be rendered
+    connect(m_view, &QQuickWindow::afterAnimating, this, &RenderGovernor::onAfterAnimating);
+
+    connect(m_view, &Latte::View::containmentChanged, this, &RenderGovernor::updateViewId);
+    connect(m_view, &Latte::View::containmentChanged, this, &RenderGovernor::onContainmentChanged);
+    connect(m_view, &Latte::View::nameChanged, this, &RenderGovernor::updateViewId);
+
+    connect(m_view, &Latte::View::containsDragChanged, this, &RenderGovernor::updateState);
+    connect(m_view, &Latte::View::inEditModeChanged, this, &RenderGovernor::updateState);
+    connect(m_view, &Latte::View::visibilityChanged, this, &RenderGovernor::onVisibilityChanged);
+    connect(KWindowSystem::self(), &KWindowSystem::compositingChanged, this, &RenderGovernor::updateState);
+
+    if (m_view->positioner()) {
+        connect(m_view->positioner(), &Positioner::inSlideAnimationChanged, this, &RenderGovernor::updateState);
+    }
+
+    onVisibilityChanged();
+}
+
+RenderGovernor::~RenderGovernor()
+{
+    m_framesTimer.stop();
+
+    if (m_view) {
+        disconnect(m_view, nullptr, this, nullptr);
+    }
+}
+
+bool RenderGovernor::isSuspended() const
+{
+    return m_isSuspended;
+}
+
+void RenderGovernor::setIsSuspended(bool suspended)
+{
+    if (m_isSuspended == suspended) {
+        return;
+    }
+
+    m_isSuspended = suspended;
+
+    const quint64 suspendedFrames = m_frameState->suspendedFrames.loadAcquire();
+
+    if (suspended) {
+        m_suspendedFramesOnSuspend = suspendedFrames;
+        m_frameState->suspendedStatePresented.storeRelease(0);
+    } else if (suspendedFrames > m_suspendedFramesOnSuspend) {
+        qDebug() << "RenderGovernor ::: view" << m_view->name() << "rendered" << (suspendedFrames - m_suspendedFramesOnSuspend) << "frames while suspended...";
+    }
+
+    m_frameState->isSuspended.storeRelease(suspended ? 1 : 0);
+
+    //! the containment pauses its animations through isSuspended and effects stop
+    //! requesting frames, so a hidden view renders nothing until it is shown again
+    emit isSuspendedChanged();
+}
+
+bool RenderGovernor::isIdle() const
+{
+    return m_isIdle;
+}
+
+void RenderGovernor::setIsIdle(bool idle)
+{
+    if (m_isIdle == idle) {
+        return;
+    }
+
+    m_isIdle = idle;
+    emit isIdleChanged();
+}
+
+int RenderGovernor::framesPerSecond() const
+{
+    return m_framesPerSecond;
+}
+
+qulonglong RenderGovernor::frames() const
+{
+    return m_frameState->frames.loadAcquire();
+}
+
+qulonglong RenderGovernor::suspendedFrames() const
+{
+    return m_frameState->suspendedFrames.loadAcquire();
+}
+
+int RenderGovernor::viewId() const
+{
+    return m_frameState->viewId.loadAcquire();
+}
+
+void RenderGovernor::updateViewId()
+{
+    const int id = m_view->containment() ? static_cast<int>(m_view->containment()->id()) : 0;
+    m_frameState->viewId.storeRelease(id);
+
+    if (id > 0) {
+        Profiler::self()->setViewName(id, QStringLiteral("View %1 %2").arg(id).arg(m_view->name()));
+    }
+}
+
+void RenderGovernor::onContainmentChanged()
+{
+    if (m_containment == m_view->containment()) {
+        return;
+    }
+
+    if (m_containment) {
+        disconnect(m_containment, nullptr, this, nullptr);
+    }
+
+    m_containment = m_view->containment();
+
+    if (m_containment) {
+        connect(m_containment, &Plasma::Containment::appletAdded, this, &RenderGovernor::onAppletAdded);
+        connect(m_containment, &Plasma::Containment::appletRemoved, this, &RenderGovernor::onAppletRemoved);
+    }
+}
+
+void RenderGovernor::onAppletAdded()
+{
+    if (Profiler::self()->isEnabled()) {
+        m_frameState->appletAddedTime.testAndSetOrdered(-1, Profiler::self()->timestamp());
+    }
+}
+
+void RenderGovernor::onAppletRemoved()
+{
+    if (Profiler::self()->isEnabled()) {
+        m_frameState->appletRemovedTime.testAndSetOrdered(-1, Profiler::self()->timestamp());
+    }
+}
+
+void RenderGovernor::markParabolicEvent()
+{
+    if (!Profiler::self()->isEnabled()) {
+        return;
+    }
+
+    //! only the first event until the next frame is measured
+    m_frameState->parabolicEventTime.testAndSetOrdered(-1, Profiler::self()->timestamp());
+}
+
+void RenderGovernor::onVisibilityChanged()
+{
+    if (m_visibility == m_view->visibility()) {
+        return;
+    }
+
+    if (m_visibility) {
+        disconnect(m_visibility, nullptr, this, nullptr);
+    }
+
+    m_visibility = m_view->visibility();
+
+    if (m_visibility) {
+        connect(m_visibility, &VisibilityManager::isHiddenChanged, this, &RenderGovernor::updateState);
+        connect(m_visibility, &VisibilityManager::containsMouseChanged, this, &RenderGovernor::updateState);
+    }
+
+    updateState();
+}
+
+void RenderGovernor::updateState()
+{
+    const bool containsMouse = m_visibility && m_visibility->containsMouse();
+    const bool isActive = containsMouse || m_view->containsDrag() || m_view->inEditMode();
+    const bool inSlideAnimation = m_view->positioner() && m_view->positioner()->inSlideAnimation();
+
+    //! without compositing the hidden view is still painted through its mask
+    const bool suspended = m_visibility
+            && m_visibility->isHidden()
+            && !isActive
+            && !inSlideAnimation
+            && KWindowSystem::compositingActive();
+
+    setIsSuspended(suspended);
+    setIsIdle(!suspended && !isActive);
+
+    //! a parabolic sweep lasts as long as the mouse hovers the view
+    Profiler *profiler = Profiler::self();
+
+    if (containsMouse && m_sweepStart < 0 && profiler->isEnabled()) {
+        m_sweepStart = profiler->timestamp();
+    } else if (!containsMouse && m_sweepStart >= 0) {
+        profiler->addEvent("input", "parabolicSweep", viewId(), m_sweepStart, profiler->timestamp() - m_sweepStart);
+        m_sweepStart = -1;
+    }
+}
+
+void RenderGovernor::onAfterAnimating()
+{
+    //! frames counter timer runs only while the view renders frames
+    if (!m_framesTimer.isActive()) {
+        m_lastCountedFrames = m_frameState->frames.loadAcquire();
+        m_framesTimer.start();
+    }
+}
+
+void RenderGovernor::onBeforeRendering(FrameState *state)
+{
+    if (Profiler::self()->isEnabled()) {
+        state->frameStart.storeRelease(Profiler::self()->timestamp());
+    }
+}
+
+void RenderGovernor::onFrameSwapped(FrameState *state)
+{
+    state->frames.fetchAndAddOrdered(1);
+
+    Profiler *profiler = Profiler::self();
+
+    if (profiler->isEnabled()) {
+        const int viewId = state->viewId.loadAcquire();
+        const qint64 now = profiler->timestamp();
+        const qint64 frameStart = state->frameStart.fetchAndStoreOrdered(-1);
+        const qint64 parabolicEventTime = state->parabolicEventTime.fetchAndStoreOrdered(-1);
+
+        if (frameStart >= 0) {
+            profiler->addEvent("rendering", "frame", viewId, frameStart, now - frameStart);
+        }
+
+        if (parabolicEventTime >= 0) {
+            profiler->addEvent("input", "parabolicLatency", viewId, parabolicEventTime, now - parabolicEventTime);
+        }
+
+        //! time until the view presents the new applets layout
+        const qint64 appletAddedTime = state->appletAddedTime.fetchAndStoreOrdered(-1);
+        const qint64 appletRemovedTime = state->appletRemovedTime.fetchAndStoreOrdered(-1);
+
+        if (appletAddedTime >= 0) {
+            profiler->addEvent("applets", "appletAddedLatency", viewId, appletAddedTime, now - appletAddedTime);
+        }
+
+        if (appletRemovedTime >= 0) {
+            profiler->addEvent("applets", "appletRemovedLatency", viewId, appletRemovedTime, now - appletRemovedTime);
+        }
+    }
+
+    //! the first frame after suspension presents the hidden view itself
+    if (state->isSuspended.loadAcquire() && !state->suspendedStatePresented.testAndSetOrdered(0, 1)) {
+        state->suspendedFrames.fetchAndAddOrdered(1);
+    }
+}
+
+void RenderGovernor::updateFramesPerSecond()
+{
+    const quint64 frames = m_frameState->frames.loadAcquire();
+    const int fps = static_cast<int>((frames - m_lastCountedFrames) * 1000 / FRAMESCOUNTERINTERVAL);
+    m_lastCountedFrames = frames;
+
+    if (fps == 0) {
+        m_framesTimer.stop();
+    }
+
+    if (m_framesPerSecond != fps) {
+        m_framesPerSecond = fps;
+        emit framesPerSecondChanged();
+    }
+}
+
+}
+}
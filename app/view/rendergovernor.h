@@ -0,0 +1,125 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef VIEWRENDERGOVERNOR_H
+#define VIEWRENDERGOVERNOR_H
+
+// Qt
+#include <QAtomicInteger>
+#include <QObject>
+#include <QPointer>
+#include <QSharedPointer>
+#include <QTimer>
+
+namespace Plasma {
+class Containment;
+}
+
+namespace Latte {
+class View;
+namespace ViewPart {
+class VisibilityManager;
+}
+}
+
+namespace Latte {
+namespace ViewPart {
+
+//! Decides how much a view needs to render. A view that is hidden does not
+//! show anything, so it is suspended and its animations are paused. Views that
+//! are not under the cursor are idle, their effects and mask updates do not
+//! request frames on their own and they are coalesced, animations driven from
+//! qml are not throttled for them. It also counts the frames that each view
+//! renders.
+class RenderGovernor: public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool isSuspended READ isSuspended NOTIFY isSuspendedChanged)
+    Q_PROPERTY(bool isIdle READ isIdle NOTIFY isIdleChanged)
+
+    Q_PROPERTY(int framesPerSecond READ framesPerSecond NOTIFY framesPerSecondChanged)
+
+public:
+    RenderGovernor(Latte::View *parent);
+    virtual ~RenderGovernor();
+
+    bool isSuspended() const;
+    bool isIdle() const;
+
+    int framesPerSecond() const;
+
+    //! total frames rendered from this view
+    Q_INVOKABLE qulonglong frames() const;
+    //! frames that were rendered while the view was suspended, apart from
+    //! the frame that presented the suspended view
+    Q_INVOKABLE qulonglong suspendedFrames() const;
+
+    //! id that identifies the view in profiler traces
+    int viewId() const;
+    //! the latency until the next frame is recorded in profiler traces
+    void markParabolicEvent();
+
+signals:
+    void isSuspendedChanged();
+    void isIdleChanged();
+    void framesPerSecondChanged();
+
+private slots:
+    void onVisibilityChanged();
+    void updateState();
+    void updateFramesPerSecond();
+    void updateViewId();
+    void onContainmentChanged();
+    void onAppletAdded();
+    void onAppletRemoved();
+    void onAfterAnimating();
+
+private:
+    //! state that is shared with the render thread, render thread callbacks keep
+    //! their own reference so it outlives the governor while a frame is in flight
+    struct FrameState {
+        QAtomicInteger<quint64> frames{0};
+        QAtomicInteger<quint64> suspendedFrames{0};
+        QAtomicInt isSuspended{0};
+        QAtomicInt suspendedStatePresented{0};
+
+        //! profiler
+        QAtomicInt viewId{0};
+        QAtomicInteger<qint64> frameStart{-1};
+        QAtomicInteger<qint64> parabolicEventTime{-1};
+        QAtomicInteger<qint64> appletAddedTime{-1};
+        QAtomicInteger<qint64> appletRemovedTime{-1};
+    };
+
+    static void onBeforeRendering(FrameState *state);
+    static void onFrameSwapped(FrameState *state);
+
+    void setIsSuspended(bool suspended);
+    void setIsIdle(bool idle);
+
+private:
+    bool m_isSuspended{false};
+    bool m_isIdle{false};
+
+    int m_framesPerSecond{0};
+
+    QSharedPointer<FrameState> m_frameState;
+
+    //! mouse is hovering the view, it is used only from gui thread
+    qint64 m_sweepStart{-1};
+
+    quint64 m_lastCountedFrames{0};
+    quint64 m_suspendedFramesOnSuspend{0};
+    QTimer m_framesTimer;
+
+    QPointer<Latte::View> m_view;
+    QPointer<Plasma::Containment> m_containment;
+    QPointer<ViewPart::VisibilityManager> m_visibility;
+};
+
+}
+}
+
+#endif
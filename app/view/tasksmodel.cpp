@@ -25,6 +25,11 @@ int TasksModel::count() const
     return m_tasks.count();
 }
 
+QList<PlasmaQuick::AppletQuickItem *> TasksModel::tasks() const
+{
+    return m_tasks;
+}
+
 int TasksModel::rowCount(const QModelIndex &parent) const
 {
     return m_tasks.count();
@@ -25,6 +25,8 @@ public:
 
     int count() const;
 
+    QList<PlasmaQuick::AppletQuickItem *> tasks() const;
+
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
     QHash<int, QByteArray> roleNames() const override;
@@ -79,6 +79,7 @@ View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassX11WM)
     //! needs to be created after Effects because it catches some of its signals
     //! and avoid a crash from View::winId() at the same time
     m_positioner = new ViewPart::Positioner(this);
+    m_renderGovernor = new ViewPart::RenderGovernor(this);
 
     // setTitle(corona->kPackage().metadata().name());
     setIcon(qGuiApp->windowIcon());
@@ -248,6 +249,10 @@ View::~View()
         delete m_appletConfigView;
     }
 
+    if (m_renderGovernor) {
+        delete m_renderGovernor;
+    }
+
     //needs to be deleted before Effects because it catches some of its signals
     if (m_positioner) {
         delete m_positioner;
@@ -404,7 +409,8 @@ void View::reloadSource()
         //     m_configView->deleteLater();
         // }
 
-        engine()->clearComponentCache();
+        //! all views share the same qml engine, its component cache is cleared
+        //! from Indicator::Factory only when indicator files have really changed
         m_layout->recreateView(containment(), settingsWindowIsShown());
     }
 }
@@ -1462,6 +1468,11 @@ ViewPart::Positioner *View::positioner() const
     return m_positioner;
 }
 
+ViewPart::RenderGovernor *View::renderGovernor() const
+{
+    return m_renderGovernor;
+}
+
 ViewPart::EventsSink *View::sink() const
 {
     return m_sink;
@@ -1651,6 +1662,12 @@ QAction *View::action(const QString &name)
     return this->containment()->actions()->action(name);
 }
 
+QObject *View::sharedTasksModel(const int &appletId) const
+{
+    Q_UNUSED(appletId)
+    return nullptr;
+}
+
 QVariantList View::containmentActions() const
 {
     QVariantList actions;
@@ -13,6 +13,7 @@
 #include "effects.h"
 #include "parabolic.h"
 #include "positioner.h"
+#include "rendergovernor.h"
 #include "eventssink.h"
 #include "visibilitymanager.h"
 #include "indicator/indicator.h"
@@ -113,6 +114,7 @@ class View : public PlasmaQuick::ContainmentView
     Q_PROPERTY(Latte::ViewPart::Indicator *indicator READ indicator NOTIFY indicatorChanged)
     Q_PROPERTY(Latte::ViewPart::Parabolic *parabolic READ parabolic NOTIFY parabolicChanged)
     Q_PROPERTY(Latte::ViewPart::Positioner *positioner READ positioner NOTIFY positionerChanged)
+    Q_PROPERTY(Latte::ViewPart::RenderGovernor *renderGovernor READ renderGovernor CONSTANT)
     Q_PROPERTY(Latte::ViewPart::EventsSink *sink READ sink NOTIFY sinkChanged)
     Q_PROPERTY(Latte::ViewPart::VisibilityManager *visibility READ visibility NOTIFY visibilityChanged)
     Q_PROPERTY(Latte::ViewPart::WindowsTracker *windowsTracker READ windowsTracker NOTIFY windowsTrackerChanged)
@@ -241,6 +243,7 @@ public:
     virtual ViewPart::Indicator *indicator() const;
     ViewPart::Parabolic *parabolic() const;
     ViewPart::Positioner *positioner() const;
+    ViewPart::RenderGovernor *renderGovernor() const;
     ViewPart::EventsSink *sink() const;
     ViewPart::VisibilityManager *visibility() const;
     ViewPart::WindowsTracker *windowsTracker() const;
@@ -278,6 +281,9 @@ public slots:
     Q_INVOKABLE bool isHighestPriorityView();
     Q_INVOKABLE QAction *action(const QString &name);
 
+    //! tasks model of the original applet that the applet with this id can reuse
+    Q_INVOKABLE virtual QObject *sharedTasksModel(const int &appletId) const;
+
 protected slots:
     void showConfigurationInterface(Plasma::Applet *applet) override;
     void showWidgetExplorer(const QPointF &point);
@@ -333,6 +339,7 @@ signals:
     void screenEdgeMarginChanged();
     void screenEdgeMarginEnabledChanged();
     void screenGeometryChanged();
+    void sharedTasksModelsChanged();
 
     void sinkChanged();
     void typeChanged();
@@ -447,6 +454,7 @@ private:
     QPointer<ViewPart::ContainmentInterface> m_interface;
     QPointer<ViewPart::Parabolic> m_parabolic;
     QPointer<ViewPart::Positioner> m_positioner;
+    QPointer<ViewPart::RenderGovernor> m_renderGovernor;
     QPointer<ViewPart::EventsSink> m_sink;
     QPointer<ViewPart::VisibilityManager> m_visibility;
     QPointer<ViewPart::WindowsTracker> m_windowsTracker;
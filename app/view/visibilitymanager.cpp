@@ -18,6 +18,7 @@
 #include "../screenpool.h"
 #include "../layouts/manager.h"
 #include "../wm/abstractwindowinterface.h"
+#include "../wm/strutscoordinator.h"
 
 // Qt
 #include <QDebug>
@@ -157,7 +158,7 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
 VisibilityManager::~VisibilityManager()
 {
     qDebug() << "VisibilityManager deleting...";
-    m_wm->removeViewStruts(*m_latteView);
+    m_wm->strutsCoordinator()->removeViewStruts(m_latteView);
 
     if (m_edgeGhostWindow) {
         m_edgeGhostWindow->deleteLater();
@@ -234,7 +235,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
 
     if (m_mode == Types::AlwaysVisible) {
         //! remove struts for old always visible mode
-        m_wm->removeViewStruts(*m_latteView);
+        m_wm->strutsCoordinator()->removeViewStruts(m_latteView);
     }
 
     m_timerShow.stop();
@@ -419,11 +420,11 @@ void VisibilityManager::updateStrutsBasedOnLayoutsAndActivities(bool forceUpdate
             //! though they should not. In such case setting struts when the windows are hidden
             //! the struts do not take any effect
             m_publishedStruts = computedStruts;
-            m_wm->setViewStruts(*m_latteView, m_publishedStruts, m_latteView->location());
+            m_wm->strutsCoordinator()->setViewStruts(m_latteView, m_publishedStruts, m_latteView->location(), forceUpdate);
         }
     } else {
         m_publishedStruts = QRect();
-        m_wm->removeViewStruts(*m_latteView);
+        m_wm->strutsCoordinator()->removeViewStruts(m_latteView);
     }
 }
 
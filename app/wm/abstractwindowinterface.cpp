@@ -8,6 +8,7 @@
 #include "abstractwindowinterface.h"
 
 // local
+#include "strutscoordinator.h"
 #include "tracker/schemes.h"
 #include "tracker/windowstracker.h"
 #include "../lattecorona.h"
@@ -26,6 +27,9 @@ namespace WindowSystem {
 #define MAXPLASMAPANELTHICKNESS 96
 #define MAXSIDEPANELTHICKNESS 512
 
+#define WINDOWSCHANGEDINTERVAL 150
+#define WINDOWSCHANGEDMAXDELAY 600
+
 #define KWINSERVICE "org.kde.KWin"
 #define KWINVIRTUALDESKTOPMANAGERNAMESPACE "org.kde.KWin.VirtualDesktopManager"
 
@@ -39,16 +43,26 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
     m_corona = qobject_cast<Latte::Corona *>(parent);
     m_windowsTracker = new Tracker::Windows(this);
     m_schemesTracker = new Tracker::Schemes(this);
+    m_strutsCoordinator = new StrutsCoordinator(this);
 
     rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
 
-    m_windowWaitingTimer.setInterval(150);
+    m_windowWaitingTimer.setInterval(WINDOWSCHANGEDINTERVAL);
     m_windowWaitingTimer.setSingleShot(true);
 
     connect(&m_windowWaitingTimer, &QTimer::timeout, this, [&]() {
-        WindowId wid = m_windowChangedWaiting;
-        m_windowChangedWaiting = QVariant();
-        emit windowChanged(wid);
+        QList<WindowId> wids = m_windowsChangedWaiting;
+        QList<WindowId> infoWids = m_windowsInfoChangedWaiting;
+        m_windowsChangedWaiting.clear();
+        m_windowsInfoChangedWaiting.clear();
+
+        if (!wids.isEmpty()) {
+            emit windowsChanged(wids);
+        }
+
+        if (!infoWids.isEmpty()) {
+            emit windowsInfoChanged(infoWids);
+        }
     });
 
     connect(this, &AbstractWindowInterface::windowRemoved, this, &AbstractWindowInterface::windowRemovedSlot);
@@ -88,6 +102,7 @@ AbstractWindowInterface::~AbstractWindowInterface()
 
     m_schemesTracker->deleteLater();
     m_windowsTracker->deleteLater();
+    m_strutsCoordinator->deleteLater();
 }
 
 bool AbstractWindowInterface::isShowingDesktop() const
@@ -130,6 +145,11 @@ Tracker::Windows *AbstractWindowInterface::windowsTracker() const
     return m_windowsTracker;
 }
 
+StrutsCoordinator *AbstractWindowInterface::strutsCoordinator() const
+{
+    return m_strutsCoordinator;
+}
+
 bool AbstractWindowInterface::isIgnored(const WindowId &wid) const
 {
     return m_ignoredWindows.contains(wid);
@@ -240,6 +260,12 @@ bool AbstractWindowInterface::isSidepanel(const QRect &wGeometry) const
     return (thicknessIsAcccepted && lengthIsAccepted && sideRatio<0.4);
 }
 
+IconImagesLoader AbstractWindowInterface::iconImagesLoaderFor(WindowId wid)
+{
+    Q_UNUSED(wid)
+    return nullptr;
+}
+
 bool AbstractWindowInterface::hasBlockedTracking(const WindowId &wid) const
 {
     return (!isWhitelistedWindow(wid) && (isRegisteredPlasmaIgnoredWindow(wid) || isIgnored(wid)));
@@ -348,6 +374,9 @@ void AbstractWindowInterface::unregisterWhitelistedWindow(WindowId wid)
 
 void AbstractWindowInterface::windowRemovedSlot(WindowId wid)
 {
+    m_windowsChangedWaiting.removeAll(wid);
+    m_windowsInfoChangedWaiting.removeAll(wid);
+
     if (m_plasmaIgnoredWindows.contains(wid)) {
         unregisterPlasmaIgnoredWindow(wid);
     }
@@ -399,29 +428,27 @@ void AbstractWindowInterface::switchToPreviousActivity()
 }
 
 //! Delay window changed triggering
-void AbstractWindowInterface::considerWindowChanged(WindowId wid)
+void AbstractWindowInterface::considerWindowChanged(WindowId wid, bool hintsRelevant)
 {
-    //! Consider if the windowChanged signal should be sent DIRECTLY or WAIT
+    //! All changed windows are collected and they are sent together as one batch
+    //! when no window changed for WINDOWSCHANGEDINTERVAL ms. Windows that keep changing
+    //! e.g. during animations can not delay the batch more than WINDOWSCHANGEDMAXDELAY ms
 
-    if (m_windowChangedWaiting == wid && m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowWaitingTimer.start();
-        return;
+    if (m_windowsChangedWaiting.isEmpty() && m_windowsInfoChangedWaiting.isEmpty()) {
+        m_windowsChangedWaitingSince.start();
     }
 
-    if (m_windowChangedWaiting != wid && !m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowChangedWaiting = wid;
-        m_windowWaitingTimer.start();
-    }
+    if (hintsRelevant) {
+        m_windowsInfoChangedWaiting.removeAll(wid);
 
-    if (m_windowChangedWaiting != wid && m_windowWaitingTimer.isActive()) {
-        m_windowWaitingTimer.stop();
-        //! sent previous waiting window
-        emit windowChanged(m_windowChangedWaiting);
+        if (!m_windowsChangedWaiting.contains(wid)) {
+            m_windowsChangedWaiting << wid;
+        }
+    } else if (!m_windowsChangedWaiting.contains(wid) && !m_windowsInfoChangedWaiting.contains(wid)) {
+        m_windowsInfoChangedWaiting << wid;
+    }
 
-        //! retrigger waiting for the upcoming window
-        m_windowChangedWaiting = wid;
+    if (!m_windowWaitingTimer.isActive() || m_windowsChangedWaitingSince.elapsed() < (WINDOWSCHANGEDMAXDELAY - WINDOWSCHANGEDINTERVAL)) {
         m_windowWaitingTimer.start();
     }
 }
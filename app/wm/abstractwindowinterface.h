@@ -12,6 +12,7 @@
 #include "schemecolors.h"
 #include "tasktools.h"
 #include "windowinfowrap.h"
+#include "tracker/applications.h"
 #include "tracker/windowstracker.h"
 
 // C++
@@ -23,6 +24,7 @@
 #include <QWindow>
 #include <QDBusServiceWatcher>
 #include <QDialog>
+#include <QElapsedTimer>
 #include <QMap>
 #include <QRect>
 #include <QPoint>
@@ -41,6 +43,7 @@
 namespace Latte {
 class Corona;
 namespace WindowSystem {
+class StrutsCoordinator;
 namespace Tracker {
 class Schemes;
 class Windows;
@@ -98,9 +101,12 @@ public:
     virtual bool windowCanBeMaximized(WindowId wid) = 0;
 
     virtual QIcon iconFor(WindowId wid) = 0;
+    //! window icons that can be loaded out of gui thread, otherwise iconFor() is used
+    virtual IconImagesLoader iconImagesLoaderFor(WindowId wid);
     virtual WindowId winIdFor(QString appId, QRect geometry) = 0;
     virtual WindowId winIdFor(QString appId, QString title) = 0;
     virtual AppData appDataFor(WindowId wid) = 0;
+    virtual ApplicationMetadata applicationMetadataFor(WindowId wid) = 0;
 
     bool isKWinRunning() const;
 
@@ -133,12 +139,17 @@ public:
     Latte::Corona *corona();
     Tracker::Schemes *schemesTracker();
     Tracker::Windows *windowsTracker() const;
+    StrutsCoordinator *strutsCoordinator() const;
 
 signals:
     void activeWindowChanged(WindowId wid);
     void windowChanged(WindowId winfo);
+    void windowsChanged(const QList<WindowId> &wids);
+    //! windows whose changes are irrelevant to tracking hints e.g. title changes
+    void windowsInfoChanged(const QList<WindowId> &wids);
     void windowAdded(WindowId wid);
     void windowRemoved(WindowId wid);
+    void windowIconChanged(WindowId wid);
     void currentDesktopChanged();
     void currentActivityChanged();
 
@@ -161,16 +172,18 @@ protected:
 
     QPointer<KActivities::Consumer> m_activities;
 
-    //! Sending too fast plenty of signals for the same window
+    //! Sending too fast plenty of signals for the same windows
     //! has no reason and can create HIGH CPU usage. This Timer
-    //! can delay the batch sending of signals for the same window
-    WindowId m_windowChangedWaiting;
+    //! delays the batch sending of signals for all changed windows
+    QList<WindowId> m_windowsChangedWaiting;
+    QList<WindowId> m_windowsInfoChangedWaiting;
+    QElapsedTimer m_windowsChangedWaitingSince;
     QTimer m_windowWaitingTimer;
 
     //! Plasma taskmanager rules ile
     KSharedConfig::Ptr rulesConfig;
 
-    void considerWindowChanged(WindowId wid);
+    void considerWindowChanged(WindowId wid, bool hintsRelevant = true);
 
     bool isIgnored(const WindowId &wid) const;
     bool isRegisteredPlasmaIgnoredWindow(const WindowId &wid) const;
@@ -199,6 +212,7 @@ private:
     Latte::Corona *m_corona;
     Tracker::Schemes *m_schemesTracker;
     Tracker::Windows *m_windowsTracker;
+    StrutsCoordinator *m_strutsCoordinator;
 
     QDBusServiceWatcher *m_kwinServiceWatcher{nullptr};
 };
@@ -10,16 +10,18 @@
 #include <config-latte.h>
 #include "../layouts/importer.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatcher.h"
 
 // Qt
 #include <QDebug>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
 #include <QLatin1String>
 
 // KDE
+#include <KConfig>
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KSharedConfig>
 
 namespace Latte {
@@ -36,27 +38,30 @@ SchemeColors::SchemeColors(QObject *parent, QString scheme, bool plasmaTheme) :
         m_schemeName = schemeName(pSchemeFile);
 
         //! track scheme file for changes
-        KDirWatch::self()->addFile(m_schemeFile);
+        m_watchedSchemeFile = m_schemeFile;
+        connect(FileWatcher::self()->addFile(m_watchedSchemeFile), &WatchedPath::changed, this, &SchemeColors::updateScheme);
+    }
 
-        connect(KDirWatch::self(), &KDirWatch::created, this, [ & ](const QString & path) {
-            if (path == m_schemeFile) {
-                updateScheme();
-            }
-        });
+    updateScheme();
+}
 
-        connect(KDirWatch::self(), &KDirWatch::dirty, this, [ & ](const QString & path) {
-            if (path == m_schemeFile) {
-                updateScheme();
-            }
-        });
-    }
+SchemeColors::SchemeColors(QObject *parent, KConfig *scheme, const QString &schemeFile, bool plasmaTheme) :
+    QObject(parent),
+    m_basedOnPlasmaTheme(plasmaTheme),
+    m_schemeFileIsWritten(false),
+    m_schemeFile(schemeFile),
+    m_scheme(scheme)
+{
+    m_schemeName = KConfigGroup(m_scheme.data(), "General").readEntry("Name", QString());
 
     updateScheme();
 }
 
 SchemeColors::~SchemeColors()
 {
-    ///
+    if (!m_watchedSchemeFile.isEmpty()) {
+        FileWatcher::self()->removePath(m_watchedSchemeFile);
+    }
 }
 
 QColor SchemeColors::backgroundColor() const
@@ -131,9 +136,41 @@ QString SchemeColors::schemeName() const
 
 QString SchemeColors::SchemeColors::schemeFile() const
 {
+    if (!m_schemeFileIsWritten) {
+        writeSchemeFile();
+    }
+
     return m_schemeFile;
 }
 
+void SchemeColors::writeSchemeFile() const
+{
+    m_schemeFileIsWritten = true;
+
+    if (!m_scheme || m_schemeFile.isEmpty()) {
+        return;
+    }
+
+    if (QFileInfo(m_schemeFile).exists()) {
+        QFile(m_schemeFile).remove();
+    }
+
+    KConfig file(m_schemeFile, KConfig::SimpleConfig);
+    copyScheme(m_scheme.data(), &file);
+    file.sync();
+
+    //! consumers in this process read the file through the shared config
+    KSharedConfig::openConfig(m_schemeFile)->reparseConfiguration();
+}
+
+void SchemeColors::copyScheme(const KConfigBase *from, KConfigBase *to)
+{
+    for (const auto &groupName : from->groupList()) {
+        KConfigGroup toGroup(to, groupName);
+        KConfigGroup(from, groupName).copyTo(&toGroup);
+    }
+}
+
 void SchemeColors::setSchemeFile(QString file)
 {
     if (m_schemeFile == file) {
@@ -227,16 +264,26 @@ QString SchemeColors::schemeName(QString originalFile)
 
 void SchemeColors::updateScheme()
 {
+    if (m_scheme) {
+        loadColors(m_scheme.data());
+        return;
+    }
+
     if (m_schemeFile.isEmpty() || !QFileInfo(m_schemeFile).exists()) {
         return;
     }
 
     KSharedConfigPtr filePtr = KSharedConfig::openConfig(m_schemeFile);
-    KConfigGroup wmGroup = KConfigGroup(filePtr, "WM");
-    KConfigGroup selGroup = KConfigGroup(filePtr, "Colors:Selection");
-    //KConfigGroup viewGroup = KConfigGroup(filePtr, "Colors:View");
-    KConfigGroup windowGroup = KConfigGroup(filePtr, "Colors:Window");
-    KConfigGroup buttonGroup = KConfigGroup(filePtr, "Colors:Button");
+    loadColors(filePtr.data());
+}
+
+void SchemeColors::loadColors(const KConfigBase *scheme)
+{
+    KConfigGroup wmGroup = KConfigGroup(scheme, "WM");
+    KConfigGroup selGroup = KConfigGroup(scheme, "Colors:Selection");
+    //KConfigGroup viewGroup = KConfigGroup(scheme, "Colors:View");
+    KConfigGroup windowGroup = KConfigGroup(scheme, "Colors:Window");
+    KConfigGroup buttonGroup = KConfigGroup(scheme, "Colors:Button");
 
     if (!m_basedOnPlasmaTheme) {
         m_activeBackgroundColor = wmGroup.readEntry("activeBackground", QColor());
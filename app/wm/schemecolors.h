@@ -10,6 +10,10 @@
 // Qt
 #include <QObject>
 #include <QColor>
+#include <QScopedPointer>
+
+class KConfig;
+class KConfigBase;
 
 namespace Latte {
 namespace WindowSystem {
@@ -37,6 +41,9 @@ class SchemeColors: public QObject
 
 public:
     SchemeColors(QObject *parent, QString scheme, bool plasmaTheme = false);
+    //! scheme that lives only in memory and takes ownership of its config,
+    //! schemeFile is written only when somebody requests it
+    SchemeColors(QObject *parent, KConfig *scheme, const QString &schemeFile, bool plasmaTheme = false);
     ~SchemeColors() override;
 
     QString schemeName() const;
@@ -62,6 +69,8 @@ public:
     static QString possibleSchemeFile(QString scheme);
     static QString schemeName(QString originalFile);
 
+    static void copyScheme(const KConfigBase *from, KConfigBase *to);
+
 signals:
     void colorsChanged();
     void schemeFileChanged();
@@ -69,11 +78,20 @@ signals:
 private slots:
     void updateScheme();
 
+private:
+    void loadColors(const KConfigBase *scheme);
+    void writeSchemeFile() const;
+
 private:
     bool m_basedOnPlasmaTheme{false};
+    mutable bool m_schemeFileIsWritten{true};
 
     QString m_schemeName;
     QString m_schemeFile;
+    //! the scheme file that is tracked for changes
+    QString m_watchedSchemeFile;
+
+    QScopedPointer<KConfig> m_scheme;
 
     QColor m_activeBackgroundColor;
     QColor m_activeTextColor;
@@ -0,0 +1,109 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "strutscoordinator.h"
+
+// local
+#include "abstractwindowinterface.h"
+#include "../view/positioner.h"
+#include "../view/view.h"
+
+#define PUBLISHINTERVAL 250
+#define PUBLISHMAXDELAY 1500
+
+namespace Latte {
+namespace WindowSystem {
+
+StrutsCoordinator::StrutsCoordinator(AbstractWindowInterface *parent)
+    : QObject(parent),
+      m_wm(parent)
+{
+    m_publishTimer.setInterval(PUBLISHINTERVAL);
+    m_publishTimer.setSingleShot(true);
+    connect(&m_publishTimer, &QTimer::timeout, this, &StrutsCoordinator::publishStruts);
+}
+
+StrutsCoordinator::~StrutsCoordinator()
+{
+    m_publishTimer.stop();
+}
+
+void StrutsCoordinator::setViewStruts(Latte::View *view, const QRect &rect, Plasma::Types::Location location, bool forced)
+{
+    if (!view) {
+        return;
+    }
+
+    if (!forced && m_published.contains(view) && m_published[view] == rect) {
+        //! a transient change returned to its published value
+        m_pending.remove(view);
+        return;
+    }
+
+    if (m_pending.isEmpty()) {
+        m_pendingTime.start();
+    }
+
+    Struts &struts = m_pending[view];
+    struts.view = view;
+    struts.rect = rect;
+    struts.location = location;
+    struts.forced = struts.forced || forced;
+
+    //! each new change delays publishing until views have settled
+    m_publishTimer.start();
+}
+
+void StrutsCoordinator::removeViewStruts(Latte::View *view)
+{
+    if (!view) {
+        return;
+    }
+
+    m_pending.remove(view);
+
+    if (m_published.contains(view)) {
+        m_published.remove(view);
+        m_wm->removeViewStruts(*view);
+    }
+}
+
+bool StrutsCoordinator::viewIsSettled(Latte::View *view) const
+{
+    return !view->positioner()
+            || (!view->positioner()->inRelocationAnimation() && !view->positioner()->inSlideAnimation());
+}
+
+void StrutsCoordinator::publishStruts()
+{
+    if (m_pendingTime.isValid() && m_pendingTime.elapsed() < PUBLISHMAXDELAY) {
+        for (const auto &struts : m_pending) {
+            if (struts.view && !viewIsSettled(struts.view)) {
+                m_publishTimer.start();
+                return;
+            }
+        }
+    }
+
+    const QHash<Latte::View *, Struts> pending = m_pending;
+    m_pending.clear();
+    m_pendingTime.invalidate();
+
+    for (const auto &struts : pending) {
+        if (!struts.view) {
+            continue;
+        }
+
+        if (!struts.forced && m_published.contains(struts.view) && m_published[struts.view] == struts.rect) {
+            continue;
+        }
+
+        m_published[struts.view] = struts.rect;
+        m_wm->setViewStruts(*struts.view, struts.rect, struts.location);
+    }
+}
+
+}
+}
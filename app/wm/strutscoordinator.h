@@ -0,0 +1,73 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef STRUTSCOORDINATOR_H
+#define STRUTSCOORDINATOR_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QRect>
+#include <QTimer>
+
+// Plasma
+#include <Plasma>
+
+namespace Latte {
+class View;
+namespace WindowSystem {
+class AbstractWindowInterface;
+}
+}
+
+namespace Latte {
+namespace WindowSystem {
+
+//! Publishes the struts of all views. Every struts change makes the window
+//! manager recompute the work area and relayout all maximized windows, so
+//! changes are collected from all views and they are published together
+//! only when views have settled. Struts that return to their published
+//! value before that, e.g. during animations, are never published.
+class StrutsCoordinator : public QObject
+{
+    Q_OBJECT
+
+public:
+    StrutsCoordinator(AbstractWindowInterface *parent);
+    ~StrutsCoordinator() override;
+
+    void setViewStruts(Latte::View *view, const QRect &rect, Plasma::Types::Location location, bool forced = false);
+    //! struts are removed immediately
+    void removeViewStruts(Latte::View *view);
+
+private slots:
+    void publishStruts();
+
+private:
+    bool viewIsSettled(Latte::View *view) const;
+
+private:
+    struct Struts {
+        QPointer<Latte::View> view;
+        QRect rect;
+        Plasma::Types::Location location{Plasma::Types::Floating};
+        bool forced{false};
+    };
+
+    QHash<Latte::View *, Struts> m_pending;
+    QHash<Latte::View *, QRect> m_published;
+
+    QElapsedTimer m_pendingTime;
+    QTimer m_publishTimer;
+
+    AbstractWindowInterface *m_wm{nullptr};
+};
+
+}
+}
+
+#endif
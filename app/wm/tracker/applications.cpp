@@ -0,0 +1,299 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "applications.h"
+
+// Qt
+#include <QFile>
+#include <QLatin1String>
+#include <QMutexLocker>
+#include <QPixmap>
+#include <QRunnable>
+
+// KDE
+#include <KDesktopFile>
+#include <KService>
+#include <KSycoca>
+
+
+namespace Latte {
+namespace WindowSystem {
+
+QString ApplicationMetadata::key() const
+{
+    return appId + QLatin1Char('\n') + wmClassName + QLatin1Char('\n') + desktopFileName + QLatin1Char('\n') + QString::number(pid);
+}
+
+QString ApplicationMetadata::applicationKey() const
+{
+    return appId + QLatin1Char('\n') + wmClassName + QLatin1Char('\n') + desktopFileName + QLatin1Char('\n') + commandLine;
+}
+
+namespace Tracker {
+
+Applications::Applications(QObject *parent)
+    : QObject(parent)
+{
+    //! identification is mostly I/O bound, one thread is enough and keeps
+    //! requests for the same application serialized
+    m_pool.setMaxThreadCount(1);
+
+    //! installed applications changed, identifications may be different now
+    connect(KSycoca::self(), qOverload<>(&KSycoca::databaseChanged), this, &Applications::clear);
+}
+
+Applications::~Applications()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+void Applications::clear()
+{
+    ++m_generation;
+
+    m_cache.clear();
+    m_icons.clear();
+
+    {
+        QMutexLocker locker(&m_urlsMutex);
+        m_urls.clear();
+    }
+
+    //! windows that are still waiting are served from new jobs
+    for (auto it = m_pendingMetadata.constBegin(); it != m_pendingMetadata.constEnd(); ++it) {
+        startResolving(it.key(), it.value());
+    }
+
+    for (auto it = m_pendingIconLoaders.constBegin(); it != m_pendingIconLoaders.constEnd(); ++it) {
+        startLoadingIcon(it.key(), it.value());
+    }
+}
+
+bool Applications::request(const WindowId &wid, const ApplicationMetadata &metadata)
+{
+    const QString key = metadata.key();
+
+    if (m_cache.contains(key)) {
+        emit resolved(wid, m_cache[key]);
+        return true;
+    }
+
+    if (m_pending.contains(key)) {
+        if (!m_pending[key].contains(wid)) {
+            m_pending[key] << wid;
+        }
+
+        return false;
+    }
+
+    m_pending[key] << wid;
+    m_pendingMetadata[key] = metadata;
+
+    startResolving(key, metadata);
+
+    return false;
+}
+
+void Applications::startResolving(const QString &key, const ApplicationMetadata &metadata)
+{
+    const int generation = m_generation;
+
+    m_pool.start(QRunnable::create([this, generation, key, metadata]() {
+        QUrl url = cachedWindowUrl(metadata);
+
+        QMetaObject::invokeMethod(this, [this, generation, key, url]() {
+            onUrlResolved(generation, key, url);
+        }, Qt::QueuedConnection);
+    }));
+}
+
+QUrl Applications::cachedWindowUrl(ApplicationMetadata metadata)
+{
+    //! /proc is read only from the worker thread
+    metadata.commandLine = commandLine(metadata.pid);
+    const QString applicationKey = metadata.applicationKey();
+
+    {
+        QMutexLocker locker(&m_urlsMutex);
+
+        if (m_urls.contains(applicationKey)) {
+            return m_urls[applicationKey];
+        }
+    }
+
+    //! KSharedConfig and KSycoca instances are per thread
+    KSharedConfig::Ptr rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
+    QUrl url = windowUrl(metadata, rulesConfig);
+
+    QMutexLocker locker(&m_urlsMutex);
+    m_urls[applicationKey] = url;
+
+    return url;
+}
+
+void Applications::requestIcon(const WindowId &wid, const QString &key, IconImagesLoader loader)
+{
+    if (m_icons.contains(key)) {
+        emit iconResolved(wid, m_icons[key]);
+        return;
+    }
+
+    if (m_pendingIcons.contains(key)) {
+        if (!m_pendingIcons[key].contains(wid)) {
+            m_pendingIcons[key] << wid;
+        }
+
+        return;
+    }
+
+    m_pendingIcons[key] << wid;
+    m_pendingIconLoaders[key] = loader;
+
+    startLoadingIcon(key, loader);
+}
+
+void Applications::startLoadingIcon(const QString &key, IconImagesLoader loader)
+{
+    const int generation = m_generation;
+    const int job = ++m_lastIconJob;
+    m_iconJobs[key] = job;
+
+    m_pool.start(QRunnable::create([this, generation, job, key, loader]() {
+        QList<QImage> images = loader();
+
+        QMetaObject::invokeMethod(this, [this, generation, job, key, images]() {
+            onIconImagesLoaded(generation, job, key, images);
+        }, Qt::QueuedConnection);
+    }));
+}
+
+void Applications::releaseIcon(const QString &key)
+{
+    m_icons.remove(key);
+
+    if (!m_pendingIcons.contains(key)) {
+        return;
+    }
+
+    if (m_pendingIcons[key].isEmpty()) {
+        //! nobody waits for it anymore, the running job result is dropped
+        m_pendingIcons.remove(key);
+        m_pendingIconLoaders.remove(key);
+        m_iconJobs.remove(key);
+        return;
+    }
+
+    //! the running job may have read the previous icon
+    startLoadingIcon(key, m_pendingIconLoaders[key]);
+}
+
+void Applications::cancel(const WindowId &wid)
+{
+    for (auto &windows : m_pending) {
+        windows.removeAll(wid);
+    }
+
+    for (auto &windows : m_pendingIcons) {
+        windows.removeAll(wid);
+    }
+}
+
+void Applications::onUrlResolved(const int &generation, const QString &key, const QUrl &url)
+{
+    if (generation != m_generation) {
+        //! a newer job for the same key is already running
+        return;
+    }
+
+    //! icons must be created in the gui thread
+    AppData data = appDataFromUrl(url);
+    m_cache[key] = data;
+
+    m_pendingMetadata.remove(key);
+    const QList<WindowId> windows = m_pending.take(key);
+
+    for (const auto &wid : windows) {
+        emit resolved(wid, data);
+    }
+}
+
+void Applications::onIconImagesLoaded(const int &generation, const int &job, const QString &key, const QList<QImage> &images)
+{
+    if (generation != m_generation || m_iconJobs.value(key) != job) {
+        return;
+    }
+
+    m_iconJobs.remove(key);
+
+    //! pixmaps must be created in the gui thread, they are added at their original
+    //! sizes and QIcon scales them only when a specific size is requested
+    QIcon icon;
+
+    for (const auto &image : images) {
+        icon.addPixmap(QPixmap::fromImage(image));
+    }
+
+    if (!icon.isNull()) {
+        m_icons[key] = icon;
+    }
+
+    m_pendingIconLoaders.remove(key);
+    const QList<WindowId> windows = m_pendingIcons.take(key);
+
+    for (const auto &wid : windows) {
+        emit iconResolved(wid, icon);
+    }
+}
+
+QString Applications::commandLine(const quint32 &pid)
+{
+    if (pid == 0) {
+        return QString();
+    }
+
+    QFile cmdline(QStringLiteral("/proc/%1/cmdline").arg(pid));
+
+    if (!cmdline.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+
+    return QString::fromLocal8Bit(cmdline.readAll());
+}
+
+QUrl Applications::windowUrl(const ApplicationMetadata &metadata, KSharedConfig::Ptr rulesConfig)
+{
+    QString desktopFile = metadata.desktopFileName;
+
+    if (!desktopFile.isEmpty()) {
+        KService::Ptr service = KService::serviceByStorageId(desktopFile);
+
+        if (service) {
+            const QString &menuId = service->menuId();
+
+            // applications: URLs are used to refer to applications by their KService::menuId
+            // (i.e. .desktop file name) rather than the absolute path to a .desktop file.
+            if (!menuId.isEmpty()) {
+                return QUrl(QStringLiteral("applications:") + menuId);
+            }
+
+            return QUrl::fromLocalFile(service->entryPath());
+        }
+
+        if (!desktopFile.endsWith(QLatin1String(".desktop"))) {
+            desktopFile.append(QLatin1String(".desktop"));
+        }
+
+        if (KDesktopFile::isDesktopFile(desktopFile) && QFile::exists(desktopFile)) {
+            return QUrl::fromLocalFile(desktopFile);
+        }
+    }
+
+    return windowUrlFromMetadata(metadata.appId, metadata.pid, rulesConfig, metadata.wmClassName);
+}
+
+}
+}
+}
@@ -0,0 +1,126 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef APPLICATIONSTRACKER_H
+#define APPLICATIONSTRACKER_H
+
+// local
+#include "../tasktools.h"
+#include "../windowinfowrap.h"
+
+// Qt
+#include <QHash>
+#include <QIcon>
+#include <QImage>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QThreadPool>
+#include <QUrl>
+
+// KDE
+#include <KSharedConfig>
+
+// C++
+#include <functional>
+
+
+namespace Latte {
+namespace WindowSystem {
+
+//! window information that is needed in order to identify the application
+//! that owns a window, it is gathered from the window system in the gui thread
+struct ApplicationMetadata
+{
+    QString appId;           // X11: WM_CLASS class, Wayland: application id
+    QString wmClassName;     // X11: WM_CLASS name
+    QString desktopFileName;
+    quint32 pid{0};
+    QString commandLine;     // command line of pid, it is read in the worker thread and used only for caching
+
+    //! identifies the windows of the same process
+    QString key() const;
+    //! identifies the processes that were launched the same way, it requires commandLine
+    QString applicationKey() const;
+};
+
+//! loads the images of a window icon, it is called from worker threads
+using IconImagesLoader = std::function<QList<QImage>()>;
+
+namespace Tracker {
+
+//! Identifies applications from their windows metadata. All the costly work
+//! (ksycoca queries, /proc reads, taskmanager rules) is done in a worker thread
+//! and results are cached based on the metadata that identify them, so windows
+//! of already identified applications are resolved immediately.
+class Applications : public QObject {
+    Q_OBJECT
+
+public:
+    Applications(QObject *parent);
+    ~Applications() override;
+
+    //! returns true when data for the window were already available and
+    //! resolved() was emitted immediately
+    bool request(const WindowId &wid, const ApplicationMetadata &metadata);
+    //! window icons are loaded once and they are served from cache
+    //! until their key is released
+    void requestIcon(const WindowId &wid, const QString &key, IconImagesLoader loader);
+    //! the icon for key is outdated, e.g. its window changed its icon or it was removed
+    void releaseIcon(const QString &key);
+    void cancel(const WindowId &wid);
+
+    //! it can be used from any thread
+    static QUrl windowUrl(const ApplicationMetadata &metadata, KSharedConfig::Ptr rulesConfig);
+    static QString commandLine(const quint32 &pid);
+
+signals:
+    void resolved(const WindowId &wid, const AppData &data);
+    void iconResolved(const WindowId &wid, const QIcon &icon);
+
+private slots:
+    void clear();
+
+private:
+    void startResolving(const QString &key, const ApplicationMetadata &metadata);
+    void startLoadingIcon(const QString &key, IconImagesLoader loader);
+
+    void onUrlResolved(const int &generation, const QString &key, const QUrl &url);
+    void onIconImagesLoaded(const int &generation, const int &job, const QString &key, const QList<QImage> &images);
+
+    //! it is called only from the worker thread
+    QUrl cachedWindowUrl(ApplicationMetadata metadata);
+
+private:
+    //! results of jobs that were started before the last clear() are dropped
+    int m_generation{0};
+
+    QThreadPool m_pool;
+
+    //! metadata key -> application data
+    QHash<QString, AppData> m_cache;
+    //! metadata key -> windows waiting for it
+    QHash<QString, QList<WindowId>> m_pending;
+    QHash<QString, ApplicationMetadata> m_pendingMetadata;
+
+    //! icon key -> window icon
+    QHash<QString, QIcon> m_icons;
+    //! icon key -> windows waiting for it
+    QHash<QString, QList<WindowId>> m_pendingIcons;
+    QHash<QString, IconImagesLoader> m_pendingIconLoaders;
+    //! icon key -> its latest icon job, results from older jobs are dropped
+    int m_lastIconJob{0};
+    QHash<QString, int> m_iconJobs;
+
+    //! application key -> application url, it is shared between gui and worker thread
+    QMutex m_urlsMutex;
+    QHash<QString, QUrl> m_urls;
+};
+
+}
+}
+}
+
+#endif
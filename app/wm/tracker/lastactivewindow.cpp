@@ -25,8 +25,6 @@ namespace WindowSystem {
 namespace Tracker {
 
 const int INVALIDWID = -1;
-const int PREFHISTORY = 14;
-const int MAXHISTORY = 22;
 
 LastActiveWindow::LastActiveWindow(TrackedGeneralInfo *trackedInfo)
     : QObject(trackedInfo),
@@ -415,7 +413,6 @@ void LastActiveWindow::setCurrentWinId(QVariant winId)
 void LastActiveWindow::setInformation(const WindowInfoWrap &info)
 {
     if (!m_trackedInfo->isTracking(info)) {
-        removeFromHistory(info.wid());
         if (m_currentWinId == info.wid()) {
             updateInformationFromHistory();
         }
@@ -478,7 +475,11 @@ void LastActiveWindow::setInformation(const WindowInfoWrap &info)
         setIcon(info.icon());
     }
 
-    appendInHistory(info.wid());
+    //! windows found from history are not activated, they must not change its order
+    if (info.isActive()) {
+        m_windowsTracker->history()->touch(info.wid());
+    }
+
     emit printRequested();
 }
 
@@ -500,78 +501,50 @@ void LastActiveWindow::windowChanged(const WindowId &wid)
         return;
     }
 
-    if (m_history.contains(wid)) {
-        WindowInfoWrap historyitem = m_windowsTracker->infoFor(wid);
-
-        if (!m_trackedInfo->isTracking(historyitem)) {
-            removeFromHistory(wid);
-            if (m_currentWinId == wid) {
-                updateInformationFromHistory();
-            }
-        } else if (!m_trackedInfo->isShown(historyitem)) {
-            if (m_currentWinId == wid) {
-                updateInformationFromHistory();
-            }
-        } else if (m_history.indexOf(wid) == 0) {
-            setInformation(historyitem);
-        }
-    } else {
-        //qDebug() << " LastActiveWindow : window is not in history";
+    //! history windows that are not the current one are filtered only when they are needed
+    if (wid != m_currentWinId) {
+        return;
     }
-}
 
-void LastActiveWindow::windowRemoved(const WindowId &wid)
-{
-    if (m_history.contains(wid)) {
-        removeFromHistory(wid);
+    WindowInfoWrap historyitem = m_windowsTracker->infoFor(wid);
+
+    if (!m_trackedInfo->isTracking(historyitem) || !m_trackedInfo->isShown(historyitem)) {
         updateInformationFromHistory();
+    } else {
+        setInformation(historyitem);
     }
 }
 
-void LastActiveWindow::cleanHistory()
+void LastActiveWindow::windowRemoved(const WindowId &wid)
 {
-    if (m_history.count() > MAXHISTORY) {
-        int size = m_history.count();
-        for(int i=0; i<(size-PREFHISTORY); ++i) {
-            if (!m_history.isEmpty()) {
-                m_history.removeLast();
-            }
-        }
+    //! the window has already been removed from history
+    if (wid == m_currentWinId) {
+        updateInformationFromHistory();
     }
 }
 
 void LastActiveWindow::printHistory() {
-    for(int i=0; i<m_history.count(); ++i) {
-        WindowInfoWrap historyitem = m_windowsTracker->infoFor(m_history[i]);
-        qDebug() << "  " << i << ". " << historyitem.wid() << " -- " << historyitem.display();
-    }
-}
+    const QList<WindowId> history = m_windowsTracker->history()->windows();
 
-void LastActiveWindow::appendInHistory(const QVariant &wid)
-{
-    if (!m_history.contains(wid)) {
-        m_history.prepend(wid);
-        cleanHistory();
-    } else {
-        int windex = m_history.indexOf(wid);
-        m_history.move(windex, 0); //! move to start
+    for(int i=0; i<history.count(); ++i) {
+        WindowInfoWrap historyitem = m_windowsTracker->infoFor(history[i]);
+        qDebug() << "  " << i << ". " << historyitem.wid() << " -- " << historyitem.display();
     }
 }
 
-void LastActiveWindow::removeFromHistory(const QVariant &wid)
-{
-    m_history.removeAll(wid);
-}
-
 void LastActiveWindow::updateInformationFromHistory()
 {
-    for(int i=0; i<m_history.count(); ++i) {
-        WindowInfoWrap historyitem = m_windowsTracker->infoFor(m_history[i]);
+    WindowInfoWrap historyitem;
 
-        if (m_trackedInfo->isTracking(historyitem) && m_trackedInfo->isShown(historyitem)) {
-            setInformation(historyitem);
-            return;
-        }
+    //! the most recent window of history that is tracked and shown from this consumer
+    WindowId wid = m_windowsTracker->history()->find([&](const WindowId &candidate) {
+        historyitem = m_windowsTracker->infoFor(candidate);
+        return m_trackedInfo->isTracking(historyitem) && m_trackedInfo->isShown(historyitem);
+    });
+
+    if (wid.isValid()) {
+        setInformation(historyitem);
+        return;
     }
 
     setIsValid(false);
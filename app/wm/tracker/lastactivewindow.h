@@ -196,10 +196,6 @@ private:
 
     void setCurrentWinId(QVariant winId);
 
-    void cleanHistory();
-    void appendInHistory(const QVariant &wid);
-    void removeFromHistory(const QVariant &wid);
-
     void updateColorScheme();
 
 private:
@@ -236,8 +232,6 @@ private:
 
     QVariant m_currentWinId;
 
-    QList<WindowId> m_history;
-
     TrackedGeneralInfo *m_trackedInfo{nullptr};
     AbstractWindowInterface *m_wm{nullptr};
     Tracker::Windows *m_windowsTracker{nullptr};
@@ -8,15 +8,14 @@
 // local
 #include "../abstractwindowinterface.h"
 #include "../../lattecorona.h"
+#include "../../layouts/importer.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatcher.h"
 
 // Qt
 #include <QDir>
 #include <QLatin1String>
 
-// KDE
-#include <KDirWatch>
-
 
 namespace Latte {
 namespace WindowSystem {
@@ -31,6 +30,10 @@ Schemes::Schemes(AbstractWindowInterface *parent)
 
 Schemes::~Schemes()
 {
+    for (const auto &path : m_watchedPaths) {
+        FileWatcher::self()->removePath(path);
+    }
+
     m_windowScheme.clear();
     //! it is just a reference to a real scheme file
     m_schemes.take("kdeglobals");
@@ -49,31 +52,57 @@ void Schemes::init()
     });
 
     connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [&](WindowId wid) {
-        m_windowScheme.remove(wid);
+        m_windowScheme.remove(windowKey(wid));
     });
 
     //! track for changing default scheme
     QString kdeSettingsFile = Latte::configPath() + "/kdeglobals";
 
-    KDirWatch::self()->addFile(kdeSettingsFile);
+    m_watchedPaths << kdeSettingsFile;
+    connect(FileWatcher::self()->addFile(kdeSettingsFile), &WatchedPath::changed, this, &Schemes::updateDefaultScheme);
 
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, kdeSettingsFile](const QString & path) {
-        if (path == kdeSettingsFile) {
-            this->updateDefaultScheme();
-        }
-    });
+    //! installed or removed schemes change how scheme names are resolved
+    for (const auto &path : Layouts::Importer::standardPaths()) {
+        QString schemesPath = path + "/color-schemes";
+        m_watchedPaths << schemesPath;
 
-    connect(KDirWatch::self(), &KDirWatch::created, this, [ &, kdeSettingsFile](const QString & path) {
-        if (path == kdeSettingsFile) {
-            this->updateDefaultScheme();
-        }
-    });
+        WatchedPath *schemesDir = FileWatcher::self()->addDir(schemesPath);
+        connect(schemesDir, &WatchedPath::changed, this, &Schemes::clearSchemeFiles);
+        connect(schemesDir, &WatchedPath::deleted, this, &Schemes::clearSchemeFiles);
+    }
+}
+
+quint64 Schemes::windowKey(const WindowId &wid)
+{
+    return wid.toULongLong();
+}
+
+void Schemes::clearSchemeFiles()
+{
+    m_schemeFiles.clear();
+}
+
+QString Schemes::schemeFile(const QString &scheme)
+{
+    auto it = m_schemeFiles.constFind(scheme);
+
+    if (it != m_schemeFiles.constEnd()) {
+        return it.value();
+    }
+
+    QString file = SchemeColors::possibleSchemeFile(scheme);
+    m_schemeFiles[scheme] = file;
+
+    return file;
 }
 
 //! Scheme support for windows
 void Schemes::updateDefaultScheme()
 {
-    QString defaultSchemePath = SchemeColors::possibleSchemeFile("kdeglobals");
+    //! kdeglobals defines which scheme is the default one
+    clearSchemeFiles();
+
+    QString defaultSchemePath = schemeFile("kdeglobals");
 
     qDebug() << " Windows default color scheme :: " << defaultSchemePath;
 
@@ -95,46 +124,53 @@ void Schemes::updateDefaultScheme()
 
 SchemeColors *Schemes::schemeForFile(const QString &scheme)
 {
-    QString schemeFile = SchemeColors::possibleSchemeFile(scheme);
+    QString file = schemeFile(scheme);
 
-    if (!schemeFile.isEmpty() && !m_schemes.contains(schemeFile)) {
+    if (!file.isEmpty() && !m_schemes.contains(file)) {
         //! when this scheme file has not been loaded yet
-        m_schemes[schemeFile] = new SchemeColors(this, schemeFile);
+        m_schemes[file] = new SchemeColors(this, file);
     }
 
-    return m_schemes.contains(schemeFile) ? m_schemes[schemeFile] : nullptr;
+    return m_schemes.value(file, nullptr);
 }
 
 SchemeColors *Schemes::schemeForWindow(WindowId wid)
 {
-    if (!m_windowScheme.contains(wid)) {
+    auto it = m_windowScheme.constFind(windowKey(wid));
+
+    if (it == m_windowScheme.constEnd()) {
         return m_schemes["kdeglobals"];
-    } else {
-        return m_schemes[m_windowScheme[wid]];
     }
 
-    return nullptr;
+    return m_schemes[it.value()];
 }
 
 void Schemes::setColorSchemeForWindow(WindowId wid, QString scheme)
 {
-    if (scheme == QLatin1String("kdeglobals") && !m_windowScheme.contains(wid)) {
+    const quint64 key = windowKey(wid);
+
+    if (scheme == QLatin1String("kdeglobals") && !m_windowScheme.contains(key)) {
         //default scheme does not have to be set
         return;
     }
 
     if (scheme == QLatin1String("kdeglobals")) {
         //! a window that previously had an explicit set scheme now is set back to default scheme
-        m_windowScheme.remove(wid);
+        m_windowScheme.remove(key);
     } else {
-        QString schemeFile = SchemeColors::possibleSchemeFile(scheme);
+        QString file = schemeFile(scheme);
 
-        if (!m_schemes.contains(schemeFile)) {
+        if (!m_schemes.contains(file)) {
             //! when this scheme file has not been loaded yet
-            m_schemes[schemeFile] = new SchemeColors(this, schemeFile);
+            m_schemes[file] = new SchemeColors(this, file);
+        }
+
+        if (m_windowScheme.value(key) == file) {
+            //! applications report their scheme on every activation
+            return;
         }
 
-        m_windowScheme[wid] = schemeFile;
+        m_windowScheme[key] = file;
     }
 
     emit colorSchemeChanged(wid);
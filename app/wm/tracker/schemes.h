@@ -10,7 +10,9 @@
 #include "../windowinfowrap.h"
 
 // Qt
+#include <QHash>
 #include <QObject>
+#include <QStringList>
 
 
 namespace Latte {
@@ -41,19 +43,31 @@ signals:
     void defaultSchemeChanged();
 
 private slots:
+    void clearSchemeFiles();
     void updateDefaultScheme();
 
 private:
     void init();
 
+    //! cached SchemeColors::possibleSchemeFile
+    QString schemeFile(const QString &scheme);
+
+    static quint64 windowKey(const WindowId &wid);
+
 private:
      AbstractWindowInterface *m_wm;
 
      //! scheme file and its loaded colors
      QMap<QString, Latte::WindowSystem::SchemeColors *> m_schemes;
 
+     //! scheme name and its resolved scheme file, empty when it was not found
+     QHash<QString, QString> m_schemeFiles;
+
      //! window id and its corresponding scheme file
-     QMap<WindowId, QString> m_windowScheme;
+     QHash<quint64, QString> m_windowScheme;
+
+     //! files and directories that are tracked for changes
+     QStringList m_watchedPaths;
 };
 
 }
@@ -18,6 +18,10 @@ TrackedLayoutInfo::TrackedLayoutInfo(Tracker::Windows *tracker, Latte::Layout::G
     : TrackedGeneralInfo(tracker),
       m_layout(layout)
 {
+    if (!m_layout) {
+        return;
+    }
+
     m_activities = m_layout->appliedActivities();
 
     connect(m_layout, &Latte::Layout::GenericLayout::activitiesChanged, this, [&]() {
@@ -34,6 +34,7 @@ class TrackedLayoutInfo : public TrackedGeneralInfo {
     Q_OBJECT
 
 public:
+    //! layout can be null for layouts that are tracked without a real layout
     TrackedLayoutInfo(Tracker::Windows *tracker, Latte::Layout::GenericLayout *layout);
     ~TrackedLayoutInfo() override;
 
@@ -20,6 +20,10 @@ TrackedViewInfo::TrackedViewInfo(Tracker::Windows *tracker, Latte::View *view)
     : TrackedGeneralInfo(tracker) ,
       m_view(view)
 {
+    if (!m_view) {
+        return;
+    }
+
     m_activities = m_view->activities();
 
     connect(m_view, &Latte::View::activitiesChanged, this, [&]() {
@@ -116,6 +120,40 @@ void TrackedViewInfo::setScreenGeometry(QRect geometry)
     m_screenGeometry = geometry;
 }
 
+QRect TrackedViewInfo::absoluteGeometry() const
+{
+    return m_view ? m_view->absoluteGeometry() : m_absoluteGeometry;
+}
+
+void TrackedViewInfo::setAbsoluteGeometry(const QRect &geometry)
+{
+    m_absoluteGeometry = geometry;
+}
+
+Plasma::Types::Location TrackedViewInfo::location() const
+{
+    return m_view ? m_view->location() : m_location;
+}
+
+void TrackedViewInfo::setLocation(Plasma::Types::Location location)
+{
+    m_location = location;
+}
+
+Plasma::Types::FormFactor TrackedViewInfo::formFactor() const
+{
+    if (m_view) {
+        return m_view->formFactor();
+    }
+
+    return (m_location == Plasma::Types::LeftEdge || m_location == Plasma::Types::RightEdge) ? Plasma::Types::Vertical : Plasma::Types::Horizontal;
+}
+
+qreal TrackedViewInfo::devicePixelRatio() const
+{
+    return m_view ? m_view->devicePixelRatio() : 1.0;
+}
+
 SchemeColors *TrackedViewInfo::touchingWindowScheme() const
 {
     return m_touchingWindowScheme;
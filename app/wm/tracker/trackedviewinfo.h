@@ -14,6 +14,9 @@
 #include <QObject>
 #include <QRect>
 
+// Plasma
+#include <Plasma>
+
 namespace Latte {
 class View;
 namespace WindowSystem {
@@ -33,6 +36,8 @@ class TrackedViewInfo : public TrackedGeneralInfo {
     Q_OBJECT
 
 public:
+    //! view can be null for views that are tracked without a Latte::View,
+    //! their geometry and location are provided through the setters
     TrackedViewInfo(Tracker::Windows *tracker, Latte::View *view);
     ~TrackedViewInfo() override;
 
@@ -54,6 +59,15 @@ public:
     QRect screenGeometry() const;
     void setScreenGeometry(QRect geometry);
 
+    QRect absoluteGeometry() const;
+    void setAbsoluteGeometry(const QRect &geometry);
+
+    Plasma::Types::Location location() const;
+    void setLocation(Plasma::Types::Location location);
+
+    Plasma::Types::FormFactor formFactor() const;
+    qreal devicePixelRatio() const;
+
     SchemeColors *touchingWindowScheme() const;
     void setTouchingWindowScheme(SchemeColors *scheme);
 
@@ -69,6 +83,8 @@ private:
     bool m_isTouchingBusyVerticalView{false};
 
     QRect m_screenGeometry;
+    QRect m_absoluteGeometry;
+    Plasma::Types::Location m_location{Plasma::Types::BottomEdge};
 
     SchemeColors *m_touchingWindowScheme{nullptr};
 
@@ -0,0 +1,126 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "windowshistory.h"
+
+namespace Latte {
+namespace WindowSystem {
+namespace Tracker {
+
+WindowsHistory::WindowsHistory()
+{
+}
+
+WindowsHistory::~WindowsHistory()
+{
+    qDeleteAll(m_nodes);
+    m_nodes.clear();
+}
+
+quint64 WindowsHistory::key(const WindowId &wid)
+{
+    return wid.toULongLong();
+}
+
+bool WindowsHistory::contains(const WindowId &wid) const
+{
+    return m_nodes.contains(key(wid));
+}
+
+int WindowsHistory::count() const
+{
+    return m_nodes.count();
+}
+
+void WindowsHistory::unlink(Node *node)
+{
+    if (node->previous) {
+        node->previous->next = node->next;
+    } else {
+        m_first = node->next;
+    }
+
+    if (node->next) {
+        node->next->previous = node->previous;
+    } else {
+        m_last = node->previous;
+    }
+
+    node->previous = nullptr;
+    node->next = nullptr;
+}
+
+void WindowsHistory::prepend(Node *node)
+{
+    node->previous = nullptr;
+    node->next = m_first;
+
+    if (m_first) {
+        m_first->previous = node;
+    }
+
+    m_first = node;
+
+    if (!m_last) {
+        m_last = node;
+    }
+}
+
+void WindowsHistory::touch(const WindowId &wid)
+{
+    Node *node = m_nodes.value(key(wid), nullptr);
+
+    if (node == m_first && node) {
+        return;
+    }
+
+    if (node) {
+        unlink(node);
+    } else {
+        node = new Node;
+        node->wid = wid;
+        m_nodes[key(wid)] = node;
+    }
+
+    prepend(node);
+}
+
+void WindowsHistory::remove(const WindowId &wid)
+{
+    Node *node = m_nodes.take(key(wid));
+
+    if (!node) {
+        return;
+    }
+
+    unlink(node);
+    delete node;
+}
+
+WindowId WindowsHistory::find(std::function<bool(const WindowId &)> filter) const
+{
+    for (Node *node = m_first; node; node = node->next) {
+        if (filter(node->wid)) {
+            return node->wid;
+        }
+    }
+
+    return WindowId();
+}
+
+QList<WindowId> WindowsHistory::windows() const
+{
+    QList<WindowId> wids;
+
+    for (Node *node = m_first; node; node = node->next) {
+        wids << node->wid;
+    }
+
+    return wids;
+}
+
+}
+}
+}
@@ -0,0 +1,71 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef WINDOWSYSTEMWINDOWSHISTORY_H
+#define WINDOWSYSTEMWINDOWSHISTORY_H
+
+// local
+#include "../windowinfowrap.h"
+
+// Qt
+#include <QHash>
+#include <QList>
+
+// C++
+#include <functional>
+
+namespace Latte {
+namespace WindowSystem {
+namespace Tracker {
+
+//! Windows in the order that they were activated, the most recent first.
+//! It is shared from all LastActiveWindow instances and each one of them
+//! views it through its own tracking filters. Activating a window that is
+//! already in history only moves it to the front.
+class WindowsHistory
+{
+public:
+    WindowsHistory();
+    ~WindowsHistory();
+
+    bool contains(const WindowId &wid) const;
+    int count() const;
+
+    //! the window becomes the most recent one
+    void touch(const WindowId &wid);
+    void remove(const WindowId &wid);
+
+    //! the most recent window that is accepted from filter, otherwise an invalid id
+    WindowId find(std::function<bool(const WindowId &)> filter) const;
+
+    //! the most recent first
+    QList<WindowId> windows() const;
+
+private:
+    struct Node {
+        WindowId wid;
+        Node *previous{nullptr};
+        Node *next{nullptr};
+    };
+
+    void unlink(Node *node);
+    void prepend(Node *node);
+
+    static quint64 key(const WindowId &wid);
+
+private:
+    Node *m_first{nullptr};
+    Node *m_last{nullptr};
+
+    QHash<quint64, Node *> m_nodes;
+
+    Q_DISABLE_COPY(WindowsHistory)
+};
+
+}
+}
+}
+
+#endif
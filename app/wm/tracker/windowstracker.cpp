@@ -6,6 +6,7 @@
 #include "windowstracker.h"
 
 // local
+#include "applications.h"
 #include "lastactivewindow.h"
 #include "schemes.h"
 #include "trackedlayoutinfo.h"
@@ -18,6 +19,7 @@
 #include "../../layouts/manager.h"
 #include "../../view/view.h"
 #include "../../view/positioner.h"
+#include "../../tools/profiler.h"
 
 // Qt
 #include <KWindowSystem>
@@ -31,6 +33,10 @@ Windows::Windows(AbstractWindowInterface *parent)
 {
     m_wm = parent;
 
+    m_applications = new Applications(this);
+    connect(m_applications, &Applications::resolved, this, &Windows::onApplicationResolved);
+    connect(m_applications, &Applications::iconResolved, this, &Windows::onIconResolved);
+
     m_extraViewHintsTimer.setInterval(600);
     m_extraViewHintsTimer.setSingleShot(true);
 
@@ -71,25 +77,68 @@ Windows::~Windows()
 void Windows::init()
 {
     connect(m_wm, &AbstractWindowInterface::windowChanged, this, [&](WindowId wid) {
+        Profiler::Scope profilerScope("windows", "windowChanged");
         m_windows[wid] = m_wm->requestInfo(wid);
         updateAllHints();
 
         emit windowChanged(wid);
     });
 
+    connect(m_wm, &AbstractWindowInterface::windowsChanged, this, [&](const QList<WindowId> &wids) {
+        Profiler::Scope profilerScope("windows", "windowsChanged");
+
+        for (const auto &wid : wids) {
+            m_windows[wid] = m_wm->requestInfo(wid);
+        }
+
+        //! hints are evaluated once for the entire batch
+        updateAllHints();
+
+        for (const auto &wid : wids) {
+            emit windowChanged(wid);
+        }
+    });
+
+    connect(m_wm, &AbstractWindowInterface::windowsInfoChanged, this, [&](const QList<WindowId> &wids) {
+        Profiler::Scope profilerScope("windows", "windowsInfoChanged");
+
+        //! changes that can not affect hints, e.g. titles, only window information is updated
+        bool hasUnknownWindows{false};
+
+        for (const auto &wid : wids) {
+            hasUnknownWindows = hasUnknownWindows || !m_windows.contains(wid);
+            m_windows[wid] = m_wm->requestInfo(wid);
+        }
+
+        if (hasUnknownWindows) {
+            updateAllHints();
+        }
+
+        for (const auto &wid : wids) {
+            emit windowChanged(wid);
+        }
+    });
+
     connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [&](WindowId wid) {
+        Profiler::Scope profilerScope("windows", "windowRemoved");
         m_windows.remove(wid);
+        m_history.remove(wid);
 
         //! application data
         m_initializedApplicationData.removeAll(wid);
         m_delayedApplicationData.removeAll(wid);
+        m_applications->cancel(wid);
+        m_applications->releaseIcon(iconKey(wid));
 
         updateAllHints();
 
         emit windowRemoved(wid);
     });
 
+    connect(m_wm, &AbstractWindowInterface::windowIconChanged, this, &Windows::onWindowIconChanged);
+
     connect(m_wm, &AbstractWindowInterface::windowAdded, this, [&](WindowId wid) {
+        Profiler::Scope profilerScope("windows", "windowAdded");
         if (!m_windows.contains(wid)) {
             m_windows.insert(wid, m_wm->requestInfo(wid));
         }
@@ -97,13 +146,23 @@ void Windows::init()
     });
 
     connect(m_wm, &AbstractWindowInterface::activeWindowChanged, this, [&](WindowId wid) {
+        Profiler::Scope profilerScope("windows", "activeWindowChanged");
+
         //! for some reason this is needed in order to update properly activeness values
         //! when the active window changes the previous active windows should be also updated
-        for (const auto view : m_views.keys()) {
-            WindowId lastWinId = m_views[view]->lastActiveWindow()->currentWinId();
+        auto updateLastActiveWindow = [&](TrackedViewInfo *info) {
+            WindowId lastWinId = info->lastActiveWindow()->currentWinId();
             if ((lastWinId) != wid && m_windows.contains(lastWinId)) {
                 m_windows[lastWinId] = m_wm->requestInfo(lastWinId);
             }
+        };
+
+        for (const auto info : m_views) {
+            updateLastActiveWindow(info);
+        }
+
+        for (const auto info : m_detachedViews) {
+            updateLastActiveWindow(info);
         }
 
         m_windows[wid] = m_wm->requestInfo(wid);
@@ -123,10 +182,12 @@ void Windows::initLayoutHints(Latte::Layout::GenericLayout *layout)
         return;
     }
 
-    setActiveWindowMaximized(layout, false);
-    setExistsWindowActive(layout, false);
-    setExistsWindowMaximized(layout, false);
-    setActiveWindowScheme(layout, nullptr);
+    TrackedLayoutInfo *info = m_layouts[layout];
+
+    setActiveWindowMaximized(info, false);
+    setExistsWindowActive(info, false);
+    setExistsWindowMaximized(info, false);
+    setActiveWindowScheme(info, nullptr);
 }
 
 void Windows::initViewHints(Latte::View *view)
@@ -135,16 +196,18 @@ void Windows::initViewHints(Latte::View *view)
         return;
     }
 
-    setActiveWindowMaximized(view, false);
-    setActiveWindowTouching(view, false);
-    setActiveWindowTouchingEdge(view, false);
-    setExistsWindowActive(view, false);
-    setExistsWindowTouching(view, false);
-    setExistsWindowTouchingEdge(view, false);
-    setExistsWindowMaximized(view, false);
-    setIsTouchingBusyVerticalView(view, false);
-    setActiveWindowScheme(view, nullptr);
-    setTouchingWindowScheme(view, nullptr);
+    TrackedViewInfo *info = m_views[view];
+
+    setActiveWindowMaximized(info, false);
+    setActiveWindowTouching(info, false);
+    setActiveWindowTouchingEdge(info, false);
+    setExistsWindowActive(info, false);
+    setExistsWindowTouching(info, false);
+    setExistsWindowTouchingEdge(info, false);
+    setExistsWindowMaximized(info, false);
+    setIsTouchingBusyVerticalView(info, false);
+    setActiveWindowScheme(info, nullptr);
+    setTouchingWindowScheme(info, nullptr);
 }
 
 AbstractWindowInterface *Windows::wm()
@@ -152,6 +215,11 @@ AbstractWindowInterface *Windows::wm()
     return m_wm;
 }
 
+WindowsHistory *Windows::history()
+{
+    return &m_history;
+}
+
 
 void Windows::addView(Latte::View *view)
 {
@@ -193,6 +261,33 @@ void Windows::removeView(Latte::View *view)
     updateRelevantLayouts();
 }
 
+TrackedViewInfo *Windows::addDetachedView(const QRect &screenGeometry, const QRect &absoluteGeometry, Plasma::Types::Location location)
+{
+    TrackedViewInfo *info = new TrackedViewInfo(this, nullptr);
+    info->setScreenGeometry(screenGeometry);
+    info->setAbsoluteGeometry(absoluteGeometry);
+    info->setLocation(location);
+    info->setEnabled(true);
+
+    m_detachedViews << info;
+
+    TrackingContext context = trackingContext();
+    updateHints(info, context);
+
+    return info;
+}
+
+TrackedLayoutInfo *Windows::addDetachedLayout()
+{
+    TrackedLayoutInfo *info = new TrackedLayoutInfo(this, nullptr);
+    info->setEnabled(true);
+
+    m_detachedLayouts << info;
+    updateHints(info, trackingContext());
+
+    return info;
+}
+
 void Windows::addRelevantLayout(Latte::View *view)
 {
     if (view->layout()) {
@@ -300,14 +395,14 @@ bool Windows::activeWindowMaximized(Latte::View *view) const
     return m_views[view]->activeWindowMaximized();
 }
 
-void Windows::setActiveWindowMaximized(Latte::View *view, bool activeMaximized)
+void Windows::setActiveWindowMaximized(TrackedViewInfo *info, bool activeMaximized)
 {
-    if (!m_views.contains(view) || m_views[view]->activeWindowMaximized() == activeMaximized) {
+    if (info->activeWindowMaximized() == activeMaximized) {
         return;
     }
 
-    m_views[view]->setActiveWindowMaximized(activeMaximized);
-    emit activeWindowMaximizedChanged(view);
+    info->setActiveWindowMaximized(activeMaximized);
+    emit activeWindowMaximizedChanged(info->view());
 }
 
 bool Windows::activeWindowTouching(Latte::View *view) const
@@ -319,14 +414,14 @@ bool Windows::activeWindowTouching(Latte::View *view) const
     return m_views[view]->activeWindowTouching();
 }
 
-void Windows::setActiveWindowTouching(Latte::View *view, bool activeTouching)
+void Windows::setActiveWindowTouching(TrackedViewInfo *info, bool activeTouching)
 {
-    if (!m_views.contains(view) || m_views[view]->activeWindowTouching() == activeTouching) {
+    if (info->activeWindowTouching() == activeTouching) {
         return;
     }
 
-    m_views[view]->setActiveWindowTouching(activeTouching);
-    emit activeWindowTouchingChanged(view);
+    info->setActiveWindowTouching(activeTouching);
+    emit activeWindowTouchingChanged(info->view());
 }
 
 bool Windows::activeWindowTouchingEdge(Latte::View *view) const
@@ -338,14 +433,14 @@ bool Windows::activeWindowTouchingEdge(Latte::View *view) const
     return m_views[view]->activeWindowTouchingEdge();
 }
 
-void Windows::setActiveWindowTouchingEdge(Latte::View *view, bool activeTouchingEdge)
+void Windows::setActiveWindowTouchingEdge(TrackedViewInfo *info, bool activeTouchingEdge)
 {
-    if (!m_views.contains(view) || m_views[view]->activeWindowTouchingEdge() == activeTouchingEdge) {
+    if (info->activeWindowTouchingEdge() == activeTouchingEdge) {
         return;
     }
 
-    m_views[view]->setActiveWindowTouchingEdge(activeTouchingEdge);
-    emit activeWindowTouchingEdgeChanged(view);
+    info->setActiveWindowTouchingEdge(activeTouchingEdge);
+    emit activeWindowTouchingEdgeChanged(info->view());
 }
 
 bool Windows::existsWindowActive(Latte::View *view) const
@@ -357,14 +452,14 @@ bool Windows::existsWindowActive(Latte::View *view) const
     return m_views[view]->existsWindowActive();
 }
 
-void Windows::setExistsWindowActive(Latte::View *view, bool windowActive)
+void Windows::setExistsWindowActive(TrackedViewInfo *info, bool windowActive)
 {
-    if (!m_views.contains(view) || m_views[view]->existsWindowActive() == windowActive) {
+    if (info->existsWindowActive() == windowActive) {
         return;
     }
 
-    m_views[view]->setExistsWindowActive(windowActive);
-    emit existsWindowActiveChanged(view);
+    info->setExistsWindowActive(windowActive);
+    emit existsWindowActiveChanged(info->view());
 }
 
 bool Windows::existsWindowMaximized(Latte::View *view) const
@@ -376,14 +471,14 @@ bool Windows::existsWindowMaximized(Latte::View *view) const
     return m_views[view]->existsWindowMaximized();
 }
 
-void Windows::setExistsWindowMaximized(Latte::View *view, bool windowMaximized)
+void Windows::setExistsWindowMaximized(TrackedViewInfo *info, bool windowMaximized)
 {
-    if (!m_views.contains(view) || m_views[view]->existsWindowMaximized() == windowMaximized) {
+    if (info->existsWindowMaximized() == windowMaximized) {
         return;
     }
 
-    m_views[view]->setExistsWindowMaximized(windowMaximized);
-    emit existsWindowMaximizedChanged(view);
+    info->setExistsWindowMaximized(windowMaximized);
+    emit existsWindowMaximizedChanged(info->view());
 }
 
 bool Windows::existsWindowTouching(Latte::View *view) const
@@ -395,14 +490,14 @@ bool Windows::existsWindowTouching(Latte::View *view) const
     return m_views[view]->existsWindowTouching();
 }
 
-void Windows::setExistsWindowTouching(Latte::View *view, bool windowTouching)
+void Windows::setExistsWindowTouching(TrackedViewInfo *info, bool windowTouching)
 {
-    if (!m_views.contains(view) || m_views[view]->existsWindowTouching() == windowTouching) {
+    if (info->existsWindowTouching() == windowTouching) {
         return;
     }
 
-    m_views[view]->setExistsWindowTouching(windowTouching);
-    emit existsWindowTouchingChanged(view);
+    info->setExistsWindowTouching(windowTouching);
+    emit existsWindowTouchingChanged(info->view());
 }
 
 bool Windows::existsWindowTouchingEdge(Latte::View *view) const
@@ -414,14 +509,14 @@ bool Windows::existsWindowTouchingEdge(Latte::View *view) const
     return m_views[view]->existsWindowTouchingEdge();
 }
 
-void Windows::setExistsWindowTouchingEdge(Latte::View *view, bool windowTouchingEdge)
+void Windows::setExistsWindowTouchingEdge(TrackedViewInfo *info, bool windowTouchingEdge)
 {
-    if (!m_views.contains(view) || m_views[view]->existsWindowTouchingEdge() == windowTouchingEdge) {
+    if (info->existsWindowTouchingEdge() == windowTouchingEdge) {
         return;
     }
 
-    m_views[view]->setExistsWindowTouchingEdge(windowTouchingEdge);
-    emit existsWindowTouchingEdgeChanged(view);
+    info->setExistsWindowTouchingEdge(windowTouchingEdge);
+    emit existsWindowTouchingEdgeChanged(info->view());
 }
 
 
@@ -434,14 +529,14 @@ bool Windows::isTouchingBusyVerticalView(Latte::View *view) const
     return m_views[view]->isTouchingBusyVerticalView();
 }
 
-void Windows::setIsTouchingBusyVerticalView(Latte::View *view, bool viewTouching)
+void Windows::setIsTouchingBusyVerticalView(TrackedViewInfo *info, bool viewTouching)
 {
-    if (!m_views.contains(view) || m_views[view]->isTouchingBusyVerticalView() == viewTouching) {
+    if (info->isTouchingBusyVerticalView() == viewTouching) {
         return;
     }
 
-    m_views[view]->setIsTouchingBusyVerticalView(viewTouching);
-    emit isTouchingBusyVerticalViewChanged(view);
+    info->setIsTouchingBusyVerticalView(viewTouching);
+    emit isTouchingBusyVerticalViewChanged(info->view());
 }
 
 SchemeColors *Windows::activeWindowScheme(Latte::View *view) const
@@ -453,14 +548,14 @@ SchemeColors *Windows::activeWindowScheme(Latte::View *view) const
     return m_views[view]->activeWindowScheme();
 }
 
-void Windows::setActiveWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme)
+void Windows::setActiveWindowScheme(TrackedViewInfo *info, WindowSystem::SchemeColors *scheme)
 {
-    if (!m_views.contains(view) || m_views[view]->activeWindowScheme() == scheme) {
+    if (info->activeWindowScheme() == scheme) {
         return;
     }
 
-    m_views[view]->setActiveWindowScheme(scheme);
-    emit activeWindowSchemeChanged(view);
+    info->setActiveWindowScheme(scheme);
+    emit activeWindowSchemeChanged(info->view());
 }
 
 SchemeColors *Windows::touchingWindowScheme(Latte::View *view) const
@@ -472,14 +567,14 @@ SchemeColors *Windows::touchingWindowScheme(Latte::View *view) const
     return m_views[view]->touchingWindowScheme();
 }
 
-void Windows::setTouchingWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme)
+void Windows::setTouchingWindowScheme(TrackedViewInfo *info, WindowSystem::SchemeColors *scheme)
 {
-    if (!m_views.contains(view) || m_views[view]->touchingWindowScheme() == scheme) {
+    if (info->touchingWindowScheme() == scheme) {
         return;
     }
 
-    m_views[view]->setTouchingWindowScheme(scheme);
-    emit touchingWindowSchemeChanged(view);
+    info->setTouchingWindowScheme(scheme);
+    emit touchingWindowSchemeChanged(info->view());
 }
 
 LastActiveWindow *Windows::lastActiveWindow(Latte::View *view)
@@ -510,14 +605,14 @@ bool Windows::activeWindowMaximized(Latte::Layout::GenericLayout *layout) const
     return m_layouts[layout]->activeWindowMaximized();
 }
 
-void Windows::setActiveWindowMaximized(Latte::Layout::GenericLayout *layout, bool activeMaximized)
+void Windows::setActiveWindowMaximized(TrackedLayoutInfo *info, bool activeMaximized)
 {
-    if (!m_layouts.contains(layout) || m_layouts[layout]->activeWindowMaximized() == activeMaximized) {
+    if (info->activeWindowMaximized() == activeMaximized) {
         return;
     }
 
-    m_layouts[layout]->setActiveWindowMaximized(activeMaximized);
-    emit activeWindowMaximizedChangedForLayout(layout);
+    info->setActiveWindowMaximized(activeMaximized);
+    emit activeWindowMaximizedChangedForLayout(info->layout());
 }
 
 bool Windows::existsWindowActive(Latte::Layout::GenericLayout *layout) const
@@ -529,14 +624,14 @@ bool Windows::existsWindowActive(Latte::Layout::GenericLayout *layout) const
     return m_layouts[layout]->existsWindowActive();
 }
 
-void Windows::setExistsWindowActive(Latte::Layout::GenericLayout *layout, bool windowActive)
+void Windows::setExistsWindowActive(TrackedLayoutInfo *info, bool windowActive)
 {
-    if (!m_layouts.contains(layout) || m_layouts[layout]->existsWindowActive() == windowActive) {
+    if (info->existsWindowActive() == windowActive) {
         return;
     }
 
-    m_layouts[layout]->setExistsWindowActive(windowActive);
-    emit existsWindowActiveChangedForLayout(layout);
+    info->setExistsWindowActive(windowActive);
+    emit existsWindowActiveChangedForLayout(info->layout());
 }
 
 bool Windows::existsWindowMaximized(Latte::Layout::GenericLayout *layout) const
@@ -548,14 +643,14 @@ bool Windows::existsWindowMaximized(Latte::Layout::GenericLayout *layout) const
     return m_layouts[layout]->existsWindowMaximized();
 }
 
-void Windows::setExistsWindowMaximized(Latte::Layout::GenericLayout *layout, bool windowMaximized)
+void Windows::setExistsWindowMaximized(TrackedLayoutInfo *info, bool windowMaximized)
 {
-    if (!m_layouts.contains(layout) || m_layouts[layout]->existsWindowMaximized() == windowMaximized) {
+    if (info->existsWindowMaximized() == windowMaximized) {
         return;
     }
 
-    m_layouts[layout]->setExistsWindowMaximized(windowMaximized);
-    emit existsWindowMaximizedChangedForLayout(layout);
+    info->setExistsWindowMaximized(windowMaximized);
+    emit existsWindowMaximizedChangedForLayout(info->layout());
 }
 
 SchemeColors *Windows::activeWindowScheme(Latte::Layout::GenericLayout *layout) const
@@ -567,14 +662,14 @@ SchemeColors *Windows::activeWindowScheme(Latte::Layout::GenericLayout *layout)
     return m_layouts[layout]->activeWindowScheme();
 }
 
-void Windows::setActiveWindowScheme(Latte::Layout::GenericLayout *layout, WindowSystem::SchemeColors *scheme)
+void Windows::setActiveWindowScheme(TrackedLayoutInfo *info, WindowSystem::SchemeColors *scheme)
 {
-    if (!m_layouts.contains(layout) || m_layouts[layout]->activeWindowScheme() == scheme) {
+    if (info->activeWindowScheme() == scheme) {
         return;
     }
 
-    m_layouts[layout]->setActiveWindowScheme(scheme);
-    emit activeWindowSchemeChangedForLayout(layout);
+    info->setActiveWindowScheme(scheme);
+    emit activeWindowSchemeChangedForLayout(info->layout());
 }
 
 LastActiveWindow *Windows::lastActiveWindow(Latte::Layout::GenericLayout *layout)
@@ -604,16 +699,9 @@ QIcon Windows::iconFor(const WindowId &wid)
     }
 
     if (m_windows[wid].icon().isNull()) {
-        AppData data = m_wm->appDataFor(wid);
-
-        QIcon icon = data.icon;
-
-        if (icon.isNull()) {
-            icon = m_wm->iconFor(wid);
-        }
-
-        m_windows[wid].setIcon(icon);
-        return icon;
+        //! when application data are not cached yet, applicationDataChanged()
+        //! is emitted as soon as the application is identified
+        requestApplicationData(wid);
     }
 
     return m_windows[wid].icon();
@@ -631,97 +719,149 @@ QString Windows::appNameFor(const WindowId &wid)
     }
 
     if (m_windows[wid].appName().isEmpty()) {
-        AppData data = m_wm->appDataFor(wid);
-
-        m_windows[wid].setAppName(data.name);
-
-        return data.name;
+        requestApplicationData(wid);
     }
 
     return m_windows[wid].appName();
 }
 
-void Windows::updateApplicationData()
+void Windows::requestApplicationData(const WindowId &wid)
 {
-    if (m_delayedApplicationData.count() > 0) {
-        for(int i=0; i<m_delayedApplicationData.count(); ++i) {
-            auto wid = m_delayedApplicationData[i];
+    m_applications->request(wid, m_wm->applicationMetadataFor(wid));
+}
 
-            if (m_windows.contains(wid)) {
-                AppData data = m_wm->appDataFor(wid);
+void Windows::onApplicationResolved(const WindowId &wid, const AppData &data)
+{
+    if (!m_windows.contains(wid)) {
+        return;
+    }
 
-                QIcon icon = data.icon;
+    QIcon icon = data.icon;
+    IconImagesLoader iconLoader;
 
-                if (icon.isNull()) {
-                    icon = m_wm->iconFor(wid);
-                }
+    if (icon.isNull()) {
+        iconLoader = m_wm->iconImagesLoaderFor(wid);
 
-                m_windows[wid].setIcon(icon);
-                m_windows[wid].setAppName(data.name);
+        //! window icons are loaded asynchronously when it is possible, until then the current one is kept
+        icon = iconLoader ? m_windows[wid].icon() : m_wm->iconFor(wid);
+    }
 
-                m_initializedApplicationData.append(wid);
+    bool changed = (m_windows[wid].appName() != data.name) || (m_windows[wid].icon().cacheKey() != icon.cacheKey());
 
-                emit applicationDataChanged(wid);
-            }
-        }
+    m_windows[wid].setIcon(icon);
+    m_windows[wid].setAppName(data.name);
+
+    if (changed) {
+        emit applicationDataChanged(wid);
     }
 
-    m_delayedApplicationData.clear();
+    if (iconLoader) {
+        //! windows of the same application may provide different icons, e.g. browser web apps,
+        //! only the application icon is shared and that is used only when it can be found
+        m_applications->requestIcon(wid, iconKey(wid), iconLoader);
+    }
 }
 
-WindowInfoWrap Windows::infoFor(const WindowId &wid) const
+void Windows::onIconResolved(const WindowId &wid, const QIcon &icon)
 {
     if (!m_windows.contains(wid)) {
-        return WindowInfoWrap();
+        return;
     }
 
-    return m_windows[wid];
+    //! icons that could not be loaded asynchronously
+    QIcon windowIcon = icon.isNull() ? m_wm->iconFor(wid) : icon;
+
+    if (m_windows[wid].icon().cacheKey() == windowIcon.cacheKey()) {
+        return;
+    }
+
+    m_windows[wid].setIcon(windowIcon);
+    emit applicationDataChanged(wid);
 }
 
+void Windows::onWindowIconChanged(const WindowId &wid)
+{
+    if (!m_windows.contains(wid)) {
+        return;
+    }
 
+    m_applications->releaseIcon(iconKey(wid));
 
-//! Windows Criteria Functions
-bool Windows::intersects(Latte::View *view, const WindowInfoWrap &winfo)
+    //! application data are served from cache and the window icon is loaded again
+    requestApplicationData(wid);
+}
+
+QString Windows::iconKey(const WindowId &wid) const
 {
-    return (!winfo.isMinimized() && !winfo.isShaded() && winfo.geometry().intersects(view->absoluteGeometry()));
+    return QStringLiteral("window:") + wid.toString();
 }
 
-bool Windows::isActive(const WindowInfoWrap &winfo)
+void Windows::updateApplicationData()
 {
-    return (winfo.isValid() && winfo.isActive() && !winfo.isMinimized());
+    //! windows metadata may have changed since their first identification,
+    //! requests with the same metadata are served from cache
+    const QList<WindowId> delayed = m_delayedApplicationData;
+    m_delayedApplicationData.clear();
+
+    for(const auto &wid : delayed) {
+        if (m_windows.contains(wid)) {
+            m_initializedApplicationData.append(wid);
+            requestApplicationData(wid);
+        }
+    }
+}
+
+WindowInfoWrap Windows::infoFor(const WindowId &wid) const
+{
+    if (!m_windows.contains(wid)) {
+        return WindowInfoWrap();
+    }
+
+    return m_windows[wid];
 }
 
-bool Windows::isActiveInViewScreen(Latte::View *view, const WindowInfoWrap &winfo)
+
+
+//! Windows Criteria Functions
+QRect Windows::trackedScreenGeometry(TrackedViewInfo *info)
 {
-    auto screenGeometry = m_views[view]->screenGeometry();
+    auto screenGeometry = info->screenGeometry();
 
-    if (KWindowSystem::isPlatformX11() && view->devicePixelRatio() != 1.0) {
+    if (KWindowSystem::isPlatformX11() && info->devicePixelRatio() != 1.0) {
         //!Fix for X11 Global Scale, I dont think this could be pixel perfect accurate
-        auto factor = view->devicePixelRatio();
+        auto factor = info->devicePixelRatio();
         screenGeometry = QRect(qRound(screenGeometry.x() * factor),
                                qRound(screenGeometry.y() * factor),
                                qRound(screenGeometry.width() * factor),
                                qRound(screenGeometry.height() * factor));
     }
 
+    return screenGeometry;
+}
+
+bool Windows::intersects(TrackedViewInfo *info, const WindowInfoWrap &winfo)
+{
+    return (!winfo.isMinimized() && !winfo.isShaded() && winfo.geometry().intersects(info->absoluteGeometry()));
+}
+
+bool Windows::isActive(const WindowInfoWrap &winfo)
+{
+    return (winfo.isValid() && winfo.isActive() && !winfo.isMinimized());
+}
+
+bool Windows::isActiveInViewScreen(TrackedViewInfo *info, const WindowInfoWrap &winfo)
+{
+    auto screenGeometry = trackedScreenGeometry(info);
+
     return (winfo.isValid()
             && winfo.isActive()
             && !winfo.isMinimized()
             && screenGeometry.intersects(winfo.geometry()));
 }
 
-bool Windows::isMaximizedInViewScreen(Latte::View *view, const WindowInfoWrap &winfo)
+bool Windows::isMaximizedInViewScreen(TrackedViewInfo *info, const WindowInfoWrap &winfo)
 {
-    auto screenGeometry = m_views[view]->screenGeometry();
-
-    if (KWindowSystem::isPlatformX11() && view->devicePixelRatio() != 1.0) {
-        //!Fix for X11 Global Scale, I dont think this could be pixel perfect accurate
-        auto factor = view->devicePixelRatio();
-        screenGeometry = QRect(qRound(screenGeometry.x() * factor),
-                               qRound(screenGeometry.y() * factor),
-                               qRound(screenGeometry.width() * factor),
-                               qRound(screenGeometry.height() * factor));
-    }
+    auto screenGeometry = trackedScreenGeometry(info);
 
     //! updated implementation to identify the screen that the maximized window is present
     //! in order to avoid: https://bugs.kde.org/show_bug.cgi?id=397700
@@ -732,72 +872,64 @@ bool Windows::isMaximizedInViewScreen(Latte::View *view, const WindowInfoWrap &w
             && screenGeometry.intersects(winfo.geometry()));
 }
 
-bool Windows::isTouchingView(Latte::View *view, const WindowSystem::WindowInfoWrap &winfo)
+bool Windows::isTouchingView(TrackedViewInfo *info, const WindowSystem::WindowInfoWrap &winfo)
 {
-    return (winfo.isValid() && intersects(view, winfo));
+    return (winfo.isValid() && intersects(info, winfo));
 }
 
-bool Windows::isTouchingViewEdge(Latte::View *view, const QRect &windowgeometry)
+bool Windows::isTouchingViewEdge(TrackedViewInfo *info, const QRect &windowgeometry)
 {
-    if (!view) {
+    if (!info) {
         return false;
     }
 
     bool inViewThicknessEdge{false};
     bool inViewLengthBoundaries{false};
 
-    QRect screenGeometry = view->screenGeometry();
-
-    if (KWindowSystem::isPlatformX11() && view->devicePixelRatio() != 1.0) {
-        //!Fix for X11 Global Scale, I dont think this could be pixel perfect accurate
-        auto factor = view->devicePixelRatio();
-        screenGeometry = QRect(qRound(screenGeometry.x() * factor),
-                               qRound(screenGeometry.y() * factor),
-                               qRound(screenGeometry.width() * factor),
-                               qRound(screenGeometry.height() * factor));
-    }
+    QRect screenGeometry = trackedScreenGeometry(info);
+    QRect viewGeometry = info->absoluteGeometry();
 
     bool inCurrentScreen{screenGeometry.contains(windowgeometry.topLeft()) || screenGeometry.contains(windowgeometry.bottomRight())};
 
     if (inCurrentScreen) {
-        if (view->location() == Plasma::Types::TopEdge) {
-            inViewThicknessEdge = (windowgeometry.y() == view->absoluteGeometry().bottom() + 1);
-        } else if (view->location() == Plasma::Types::BottomEdge) {
-            inViewThicknessEdge = (windowgeometry.bottom() == view->absoluteGeometry().top() - 1);
-        } else if (view->location() == Plasma::Types::LeftEdge) {
-            inViewThicknessEdge = (windowgeometry.x() == view->absoluteGeometry().right() + 1);
-        } else if (view->location() == Plasma::Types::RightEdge) {
-            inViewThicknessEdge = (windowgeometry.right() == view->absoluteGeometry().left() - 1);
+        if (info->location() == Plasma::Types::TopEdge) {
+            inViewThicknessEdge = (windowgeometry.y() == viewGeometry.bottom() + 1);
+        } else if (info->location() == Plasma::Types::BottomEdge) {
+            inViewThicknessEdge = (windowgeometry.bottom() == viewGeometry.top() - 1);
+        } else if (info->location() == Plasma::Types::LeftEdge) {
+            inViewThicknessEdge = (windowgeometry.x() == viewGeometry.right() + 1);
+        } else if (info->location() == Plasma::Types::RightEdge) {
+            inViewThicknessEdge = (windowgeometry.right() == viewGeometry.left() - 1);
         }
 
-        if (view->formFactor() == Plasma::Types::Horizontal) {
-            int yCenter = view->absoluteGeometry().center().y();
+        if (info->formFactor() == Plasma::Types::Horizontal) {
+            int yCenter = viewGeometry.center().y();
 
             QPoint leftChecker(windowgeometry.left(), yCenter);
             QPoint rightChecker(windowgeometry.right(), yCenter);
 
-            bool fulloverlap = (windowgeometry.left()<=view->absoluteGeometry().left()) && (windowgeometry.right()>=view->absoluteGeometry().right());
+            bool fulloverlap = (windowgeometry.left()<=viewGeometry.left()) && (windowgeometry.right()>=viewGeometry.right());
 
-            inViewLengthBoundaries = fulloverlap || view->absoluteGeometry().contains(leftChecker) || view->absoluteGeometry().contains(rightChecker);
-        } else if (view->formFactor() == Plasma::Types::Vertical) {
-            int xCenter = view->absoluteGeometry().center().x();
+            inViewLengthBoundaries = fulloverlap || viewGeometry.contains(leftChecker) || viewGeometry.contains(rightChecker);
+        } else if (info->formFactor() == Plasma::Types::Vertical) {
+            int xCenter = viewGeometry.center().x();
 
             QPoint topChecker(xCenter, windowgeometry.top());
             QPoint bottomChecker(xCenter, windowgeometry.bottom());
 
-            bool fulloverlap = (windowgeometry.top()<=view->absoluteGeometry().top()) && (windowgeometry.bottom()>=view->absoluteGeometry().bottom());
+            bool fulloverlap = (windowgeometry.top()<=viewGeometry.top()) && (windowgeometry.bottom()>=viewGeometry.bottom());
 
-            inViewLengthBoundaries = fulloverlap || view->absoluteGeometry().contains(topChecker) || view->absoluteGeometry().contains(bottomChecker);
+            inViewLengthBoundaries = fulloverlap || viewGeometry.contains(topChecker) || viewGeometry.contains(bottomChecker);
         }
     }
 
     return (inViewThicknessEdge && inViewLengthBoundaries);
 }
 
-bool Windows::isTouchingViewEdge(Latte::View *view, const WindowInfoWrap &winfo)
+bool Windows::isTouchingViewEdge(TrackedViewInfo *info, const WindowInfoWrap &winfo)
 {
     if (winfo.isValid() &&  !winfo.isMinimized()) {
-        return isTouchingViewEdge(view, winfo.geometry());
+        return isTouchingViewEdge(info, winfo.geometry());
     }
 
     return false;
@@ -840,12 +972,27 @@ void Windows::updateAllHintsAfterTimer()
 
 void Windows::updateAllHints()
 {
+    //! the counters of the window events above and of this scope provide
+    //! the events rate and the hints latency per event in profiler traces
+    Profiler::Scope profilerScope("windows", "updateAllHints");
+
+    //! windows are filtered once for all views and layouts
+    TrackingContext context = trackingContext();
+
     for (const auto view : m_views.keys()) {
-        updateHints(view);
+        updateHints(view, context);
     }
 
     for (const auto layout : m_layouts.keys()) {
-        updateHints(layout);
+        updateHints(layout, context);
+    }
+
+    for (const auto info : m_detachedViews) {
+        updateHints(info, context);
+    }
+
+    for (const auto info : m_detachedLayouts) {
+        updateHints(info, context);
     }
 
     if (!m_extraViewHintsTimer.isActive()) {
@@ -871,7 +1018,7 @@ void Windows::updateExtraViewHints()
                 bool sameScreen = (verView->positioner()->currentScreenId() == horView->positioner()->currentScreenId());
 
                 if (verView->formFactor() == Plasma::Types::Vertical && sameScreen) {
-                    bool hasEdgeTouch = isTouchingViewEdge(horView, verView->absoluteGeometry());
+                    bool hasEdgeTouch = isTouchingViewEdge(m_views[horView], verView->absoluteGeometry());
 
                     bool topTouch = horView->location() == Plasma::Types::TopEdge && verView->isTouchingTopViewAndIsBusy() && hasEdgeTouch;
                     bool bottomTouch = horView->location() == Plasma::Types::BottomEdge && verView->isTouchingBottomViewAndIsBusy() && hasEdgeTouch;
@@ -885,9 +1032,74 @@ void Windows::updateExtraViewHints()
 
             //qDebug() << " Touching Busy Vertical View :: " << horView->location() << " - " << horView->positioner()->currentScreenId() << " :: " << touchingBusyVerticalView;
 
-            setIsTouchingBusyVerticalView(horView, touchingBusyVerticalView);
+            setIsTouchingBusyVerticalView(m_views[horView], touchingBusyVerticalView);
+        }
+    }
+}
+
+Windows::TrackingContext Windows::trackingContext()
+{
+    TrackingContext context;
+
+    if (m_wm->isShowingDesktop()) {
+        return context;
+    }
+
+    //! the notification window is not sending a remove signal and creates windows of geometry (0x0 0,0),
+    //! maybe a garbage collector here is a good idea!!!
+    for (const auto &winfo : m_windows) {
+        if (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0)) {
+            cleanupFaultyWindows();
+            break;
+        }
+    }
+
+    for (const auto &winfo : m_windows) {
+        if (!m_wm->inCurrentDesktopActivity(winfo)
+                || m_wm->hasBlockedTracking(winfo.wid())
+                || winfo.isMinimized()) {
+            continue;
+        }
+
+        context.windows << &winfo;
+
+        //! layouts hints
+        if (isActive(winfo)) {
+            context.foundActive = true;
+            context.activeWinId = winfo.wid();
+
+            if (winfo.isMaximized() && !winfo.isMinimized()) {
+                context.foundActiveMaximized = true;
+            }
+        }
+
+        if (!context.foundActiveMaximized && winfo.isMaximized() && !winfo.isMinimized()) {
+            context.foundMaximized = true;
         }
     }
+
+    return context;
+}
+
+const QList<const WindowInfoWrap *> &Windows::screenWindows(TrackingContext &context, const QRect &screenGeometry)
+{
+    for (const auto &screen : context.screens) {
+        if (screen.first == screenGeometry) {
+            return screen.second;
+        }
+    }
+
+    //! windows that are not present in a screen can not be active, maximized or touching for its views
+    QList<const WindowInfoWrap *> windows;
+
+    for (const auto winfo : context.windows) {
+        if (screenGeometry.intersects(winfo->geometry())) {
+            windows << winfo;
+        }
+    }
+
+    context.screens << qMakePair(screenGeometry, windows);
+    return context.screens.last().second;
 }
 
 void Windows::updateHints(Latte::View *view)
@@ -896,7 +1108,28 @@ void Windows::updateHints(Latte::View *view)
         return;
     }
 
-    bool foundActive{false};
+    TrackingContext context = trackingContext();
+    updateHints(view, context);
+}
+
+void Windows::updateHints(Latte::View *view, TrackingContext &context)
+{
+    if (!m_views.contains(view)) {
+        return;
+    }
+
+    updateHints(m_views[view], context);
+}
+
+void Windows::updateHints(TrackedViewInfo *info, TrackingContext &context)
+{
+    if (!info->enabled() || !info->isTrackingCurrentActivity()) {
+        return;
+    }
+
+    Latte::View *view = info->view();
+    Profiler::Scope profilerScope("windows", "updateHints", view && view->renderGovernor() ? view->renderGovernor()->viewId() : 0);
+
     bool foundActiveInCurScreen{false};
     bool foundActiveTouchInCurScreen{false};
     bool foundActiveEdgeTouchInCurScreen{false};
@@ -906,10 +1139,6 @@ void Windows::updateHints(Latte::View *view)
 
     bool foundActiveGroupTouchInCurScreen{false};
 
-    //! the notification window is not sending a remove signal and creates windows of geometry (0x0 0,0),
-    //! maybe a garbage collector here is a good idea!!!
-    bool existsFaultyWindow{false};
-
     WindowId maxWinId;
     WindowId activeWinId;
     WindowId touchWinId;
@@ -919,45 +1148,32 @@ void Windows::updateHints(Latte::View *view)
 
     //qDebug() << " -- TRACKING REPORT (SCREEN)--";
 
-    //! First Pass
-    for (const auto &winfo : m_windows) {
-        if (m_wm->isShowingDesktop()) {
-            break;
-        }
+    //! windows of the view screen that pass the common tracking filters
+    const QList<const WindowInfoWrap *> &windows = screenWindows(context, trackedScreenGeometry(info));
 
-        if (!existsFaultyWindow && (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0))) {
-            existsFaultyWindow = true;
-        }
-
-        if ( !m_wm->inCurrentDesktopActivity(winfo)
-             || m_wm->hasBlockedTracking(winfo.wid())
-             || winfo.isMinimized()) {
-            continue;
-        }
+    //! First Pass
+    for (const auto window : windows) {
+        const WindowInfoWrap &winfo = *window;
 
         //qDebug() << " _ _ _ ";
         //qDebug() << "TRACKING | WINDOW INFO :: " << winfo.wid() << " _ " << winfo.appName() << " _ " << winfo.geometry() << " _ " << winfo.display();
 
-        if (isActive(winfo)) {
-            foundActive = true;
-        }
-
-        if (isActiveInViewScreen(view, winfo)) {
+        if (isActiveInViewScreen(info, winfo)) {
             foundActiveInCurScreen = true;
             activeWinId = winfo.wid();
         }
 
         //! Maximized windows flags
-        if ((winfo.isActive() && isMaximizedInViewScreen(view, winfo)) //! active maximized windows have higher priority than the rest maximized windows
-                || (!foundMaximizedInCurScreen && isMaximizedInViewScreen(view, winfo))) {
+        if ((winfo.isActive() && isMaximizedInViewScreen(info, winfo)) //! active maximized windows have higher priority than the rest maximized windows
+                || (!foundMaximizedInCurScreen && isMaximizedInViewScreen(info, winfo))) {
             foundMaximizedInCurScreen = true;
             maxWinId = winfo.wid();
         }
 
         //! Touching windows flags
 
-        bool touchingViewEdge = isTouchingViewEdge(view, winfo);
-        bool touchingView =  isTouchingView(view, winfo);
+        bool touchingViewEdge = isTouchingViewEdge(info, winfo);
+        bool touchingView =  isTouchingView(info, winfo);
 
         if (touchingView) {
             if (winfo.isActive()) {
@@ -983,10 +1199,6 @@ void Windows::updateHints(Latte::View *view)
         //qDebug() << "TRACKING |       TOUCHING VIEW EDGE:"<< touchingViewEdge << " TOUCHING VIEW:" << foundTouchInCurScreen;
     }
 
-    if (existsFaultyWindow) {
-        cleanupFaultyWindows();
-    }
-
     //! PASS 2
     if (!m_wm->isShowingDesktop() && foundActiveInCurScreen && !foundActiveTouchInCurScreen) {
         //! Second Pass to track also Child windows if needed
@@ -1000,13 +1212,8 @@ void Windows::updateHints(Latte::View *view)
         WindowInfoWrap activeInfo = m_windows[activeWinId];
         WindowId mainWindowId = activeInfo.isChildWindow() ? activeInfo.parentId() : activeWinId;
 
-        for (const auto &winfo : m_windows) {
-            if (!m_wm->inCurrentDesktopActivity(winfo)
-                    || m_wm->hasBlockedTracking(winfo.wid())
-                    || winfo.isMinimized()) {
-                continue;
-            }
-
+        for (const auto window : windows) {
+            const WindowInfoWrap &winfo = *window;
             bool inActiveGroup = (winfo.wid() == mainWindowId || winfo.parentId() == mainWindowId);
 
             //! consider only windows that belong to active window group meaning the main window
@@ -1015,7 +1222,7 @@ void Windows::updateHints(Latte::View *view)
                 continue;
             }
 
-            if (isTouchingView(view, winfo)) {
+            if (isTouchingView(info, winfo)) {
                 foundActiveGroupTouchInCurScreen = true;
                 break;
             }
@@ -1034,34 +1241,34 @@ void Windows::updateHints(Latte::View *view)
     //foundTouchInCurScreen = foundTouchInCurScreen && foundActive;
 
     //! assign flags
-    setExistsWindowActive(view, foundActiveInCurScreen);
-    setActiveWindowTouching(view, foundActiveTouchInCurScreen || foundActiveGroupTouchInCurScreen);
-    setActiveWindowTouchingEdge(view, foundActiveEdgeTouchInCurScreen);
-    setActiveWindowMaximized(view, (maxWinId.toInt()>0 && (maxWinId == activeTouchWinId || maxWinId == activeTouchEdgeWinId)));
-    setExistsWindowMaximized(view, foundMaximizedInCurScreen);
-    setExistsWindowTouching(view, (foundTouchInCurScreen || foundActiveTouchInCurScreen || foundActiveGroupTouchInCurScreen));
-    setExistsWindowTouchingEdge(view, (foundActiveEdgeTouchInCurScreen || foundTouchEdgeInCurScreen));
+    setExistsWindowActive(info, foundActiveInCurScreen);
+    setActiveWindowTouching(info, foundActiveTouchInCurScreen || foundActiveGroupTouchInCurScreen);
+    setActiveWindowTouchingEdge(info, foundActiveEdgeTouchInCurScreen);
+    setActiveWindowMaximized(info, (maxWinId.toInt()>0 && (maxWinId == activeTouchWinId || maxWinId == activeTouchEdgeWinId)));
+    setExistsWindowMaximized(info, foundMaximizedInCurScreen);
+    setExistsWindowTouching(info, (foundTouchInCurScreen || foundActiveTouchInCurScreen || foundActiveGroupTouchInCurScreen));
+    setExistsWindowTouchingEdge(info, (foundActiveEdgeTouchInCurScreen || foundTouchEdgeInCurScreen));
 
     //! update color schemes for active and touching windows
-    setActiveWindowScheme(view, (foundActiveInCurScreen ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
+    setActiveWindowScheme(info, (foundActiveInCurScreen ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
 
     if (foundActiveTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(activeTouchWinId));
+        setTouchingWindowScheme(info, m_wm->schemesTracker()->schemeForWindow(activeTouchWinId));
     } else if (foundActiveEdgeTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(activeTouchEdgeWinId));
+        setTouchingWindowScheme(info, m_wm->schemesTracker()->schemeForWindow(activeTouchEdgeWinId));
     } else if (foundMaximizedInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(maxWinId));
+        setTouchingWindowScheme(info, m_wm->schemesTracker()->schemeForWindow(maxWinId));
     } else if (foundTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(touchWinId));
+        setTouchingWindowScheme(info, m_wm->schemesTracker()->schemeForWindow(touchWinId));
     } else if (foundTouchEdgeInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(touchEdgeWinId));
+        setTouchingWindowScheme(info, m_wm->schemesTracker()->schemeForWindow(touchEdgeWinId));
     } else {
-        setTouchingWindowScheme(view, nullptr);
+        setTouchingWindowScheme(info, nullptr);
     }
 
     //! update LastActiveWindow
     if (foundActiveInCurScreen) {
-        m_views[view]->setActiveWindow(activeWinId);
+        info->setActiveWindow(activeWinId);
     }
 
     //! Debug
@@ -1079,53 +1286,29 @@ void Windows::updateHints(Latte::Layout::GenericLayout *layout) {
         return;
     }
 
-    bool foundActive{false};
-    bool foundActiveMaximized{false};
-    bool foundMaximized{false};
-
-    //! the notification window is not sending a remove signal and creates windows of geometry (0x0 0,0),
-    //! maybe a garbage collector here is a good idea!!!
-    bool existsFaultyWindow{false};
-
-    WindowId activeWinId;
-    WindowId maxWinId;
-
-    for (const auto &winfo : m_windows) {
-        if (m_wm->isShowingDesktop()) {
-            break;
-        }
-
-        if (!existsFaultyWindow && (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0))) {
-            existsFaultyWindow = true;
-        }
+    updateHints(layout, trackingContext());
+}
 
-        if (!m_wm->inCurrentDesktopActivity(winfo)
-                || m_wm->hasBlockedTracking(winfo.wid())
-                || winfo.isMinimized()) {
-            continue;
-        }
+void Windows::updateHints(Latte::Layout::GenericLayout *layout, const TrackingContext &context) {
+    if (!m_layouts.contains(layout)) {
+        return;
+    }
 
-        if (isActive(winfo)) {
-            foundActive = true;
-            activeWinId = winfo.wid();
+    updateHints(m_layouts[layout], context);
+}
 
-            if (winfo.isMaximized() && !winfo.isMinimized()) {
-                foundActiveMaximized = true;
-                maxWinId = winfo.wid();
-            }
-        }
+void Windows::updateHints(TrackedLayoutInfo *info, const TrackingContext &context) {
+    if (!info->enabled() || !info->isTrackingCurrentActivity()) {
+        return;
+    }
 
-        if (!foundActiveMaximized && winfo.isMaximized() && !winfo.isMinimized()) {
-            foundMaximized = true;
-            maxWinId = winfo.wid();
-        }
+    Profiler::Scope profilerScope("windows", "updateLayoutHints");
 
-        //qDebug() << "window geometry ::: " << winfo.geometry();
-    }
+    bool foundActive{context.foundActive};
+    bool foundActiveMaximized{context.foundActiveMaximized};
+    bool foundMaximized{context.foundMaximized};
 
-    if (existsFaultyWindow) {
-        cleanupFaultyWindows();
-    }
+    WindowId activeWinId{context.activeWinId};
 
     //! HACK: KWin Effects such as ShowDesktop have no way to be identified and as such
     //! create issues with identifying properly touching and maximized windows. BUT when
@@ -1138,21 +1321,21 @@ void Windows::updateHints(Latte::Layout::GenericLayout *layout) {
     //foundTouchInCurScreen = foundTouchInCurScreen && foundActive;
 
     //! assign flags
-    setExistsWindowActive(layout, foundActive);
-    setActiveWindowMaximized(layout, foundActiveMaximized);
-    setExistsWindowMaximized(layout, foundActiveMaximized || foundMaximized);
+    setExistsWindowActive(info, foundActive);
+    setActiveWindowMaximized(info, foundActiveMaximized);
+    setExistsWindowMaximized(info, foundActiveMaximized || foundMaximized);
 
     //! update color schemes for active and touching windows
-    setActiveWindowScheme(layout, (foundActive ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
+    setActiveWindowScheme(info, (foundActive ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
 
     //! update LastActiveWindow
     if (foundActive) {
-        m_layouts[layout]->setActiveWindow(activeWinId);
+        info->setActiveWindow(activeWinId);
     }
 
     //! Debug
     //qDebug() << " -- TRACKING REPORT (LAYOUT) --";
-    //qDebug() << "TRACKING | LAYOUT: " << layout->name() << " , ENABLED:" << enabled(layout);
+    //qDebug() << "TRACKING | LAYOUT: " << info->layout()->name() << " , ENABLED:" << info->enabled();
     //qDebug() << "TRACKING | existsActiveWindow: " << foundActive << " ,activeWindowMaximized: " << foundActiveMaximized;
     //qDebug() << "TRACKING | existsWindowMaximized: " << existsWindowMaximized(layout);
 }
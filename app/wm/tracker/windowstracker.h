@@ -8,15 +8,23 @@
 
 // local
 #include <coretypes.h>
+#include "windowshistory.h"
+#include "../tasktools.h"
 #include "../windowinfowrap.h"
 
 // Qt
 #include <QObject>
 
 #include <QHash>
+#include <QList>
 #include <QMap>
+#include <QPair>
+#include <QRect>
 #include <QTimer>
 
+// Plasma
+#include <Plasma>
+
 
 namespace Latte {
 class View;
@@ -27,6 +35,7 @@ namespace WindowSystem {
 class AbstractWindowInterface;
 class SchemeColors;
 namespace Tracker {
+class Applications;
 class LastActiveWindow;
 class TrackedLayoutInfo;
 class TrackedViewInfo;
@@ -48,6 +57,11 @@ public:
     void addView(Latte::View *view);
     void removeView(Latte::View *view);
 
+    //! views and layouts that are tracked without a Latte::View or a layout, their hints
+    //! are updated together with the real ones, e.g. benchmarks replaying windows streams
+    TrackedViewInfo *addDetachedView(const QRect &screenGeometry, const QRect &absoluteGeometry, Plasma::Types::Location location);
+    TrackedLayoutInfo *addDetachedLayout();
+
     //! Views Tracking (current screen specific)
     bool enabled(Latte::View *view);
     void setEnabled(Latte::View *view, const bool enabled);
@@ -78,6 +92,9 @@ public:
     QString appNameFor(const WindowId &wid);
     WindowInfoWrap infoFor(const WindowId &wid) const;
 
+    //! activated windows history shared from all LastActiveWindow instances
+    WindowsHistory *history();
+
     AbstractWindowInterface *wm();
 
 signals:
@@ -118,46 +135,75 @@ private slots:
 
     void updateApplicationData();
     void updateRelevantLayouts();
+    void onApplicationResolved(const WindowId &wid, const AppData &data);
+    void onIconResolved(const WindowId &wid, const QIcon &icon);
+    void onWindowIconChanged(const WindowId &wid);
     void updateExtraViewHints();
 
 private:
+    //! windows that pass the common tracking filters (desktop, activity, minimized, blocked),
+    //! they are found once per hints pass and they are shared from all views and layouts
+    struct TrackingContext {
+        QList<const WindowInfoWrap *> windows;
+        //! windows per screen geometry, they are found on demand
+        QList<QPair<QRect, QList<const WindowInfoWrap *>>> screens;
+
+        //! layouts hints are the same for all layouts that track the current activity
+        bool foundActive{false};
+        bool foundActiveMaximized{false};
+        bool foundMaximized{false};
+        WindowId activeWinId;
+    };
+
     void init();
     void initLayoutHints(Latte::Layout::GenericLayout *layout);
     void initViewHints(Latte::View *view);
     void cleanupFaultyWindows();
 
+    void requestApplicationData(const WindowId &wid);
+    QString iconKey(const WindowId &wid) const;
+
     void updateAllHints();
     void updateAllHintsAfterTimer();
 
     //! Views
     void updateHints(Latte::View *view);
     void updateHints(Latte::Layout::GenericLayout *layout);
-
-    void setActiveWindowMaximized(Latte::View *view, bool activeMaximized);
-    void setActiveWindowTouching(Latte::View *view, bool activeTouching);
-    void setActiveWindowTouchingEdge(Latte::View *view, bool activeTouchingEdge);
-    void setExistsWindowActive(Latte::View *view, bool windowActive);
-    void setExistsWindowMaximized(Latte::View *view, bool windowMaximized);
-    void setExistsWindowTouching(Latte::View *view, bool windowTouching);
-    void setExistsWindowTouchingEdge(Latte::View *view, bool windowTouchingEdge);
-    void setIsTouchingBusyVerticalView(Latte::View *view, bool viewTouching);
-    void setActiveWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme);
-    void setTouchingWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme);
+    void updateHints(Latte::View *view, TrackingContext &context);
+    void updateHints(Latte::Layout::GenericLayout *layout, const TrackingContext &context);
+    void updateHints(TrackedViewInfo *info, TrackingContext &context);
+    void updateHints(TrackedLayoutInfo *info, const TrackingContext &context);
+
+    TrackingContext trackingContext();
+    const QList<const WindowInfoWrap *> &screenWindows(TrackingContext &context, const QRect &screenGeometry);
+
+    void setActiveWindowMaximized(TrackedViewInfo *info, bool activeMaximized);
+    void setActiveWindowTouching(TrackedViewInfo *info, bool activeTouching);
+    void setActiveWindowTouchingEdge(TrackedViewInfo *info, bool activeTouchingEdge);
+    void setExistsWindowActive(TrackedViewInfo *info, bool windowActive);
+    void setExistsWindowMaximized(TrackedViewInfo *info, bool windowMaximized);
+    void setExistsWindowTouching(TrackedViewInfo *info, bool windowTouching);
+    void setExistsWindowTouchingEdge(TrackedViewInfo *info, bool windowTouchingEdge);
+    void setIsTouchingBusyVerticalView(TrackedViewInfo *info, bool viewTouching);
+    void setActiveWindowScheme(TrackedViewInfo *info, WindowSystem::SchemeColors *scheme);
+    void setTouchingWindowScheme(TrackedViewInfo *info, WindowSystem::SchemeColors *scheme);
 
     //! Layouts
-    void setActiveWindowMaximized(Latte::Layout::GenericLayout *layout, bool activeMaximized);
-    void setExistsWindowActive(Latte::Layout::GenericLayout *layout, bool windowActive);
-    void setExistsWindowMaximized(Latte::Layout::GenericLayout *layout, bool windowMaximized);
-    void setActiveWindowScheme(Latte::Layout::GenericLayout *layout, WindowSystem::SchemeColors *scheme);
+    void setActiveWindowMaximized(TrackedLayoutInfo *info, bool activeMaximized);
+    void setExistsWindowActive(TrackedLayoutInfo *info, bool windowActive);
+    void setExistsWindowMaximized(TrackedLayoutInfo *info, bool windowMaximized);
+    void setActiveWindowScheme(TrackedLayoutInfo *info, WindowSystem::SchemeColors *scheme);
 
     //! Windows
-    bool intersects(Latte::View *view, const WindowInfoWrap &winfo);
+    QRect trackedScreenGeometry(TrackedViewInfo *info);
+
+    bool intersects(TrackedViewInfo *info, const WindowInfoWrap &winfo);
     bool isActive(const WindowInfoWrap &winfo);
-    bool isActiveInViewScreen(Latte::View *view, const WindowInfoWrap &winfo);
-    bool isMaximizedInViewScreen(Latte::View *view, const WindowInfoWrap &winfo);
-    bool isTouchingView(Latte::View *view, const WindowSystem::WindowInfoWrap &winfo);
-    bool isTouchingViewEdge(Latte::View *view, const WindowInfoWrap &winfo);
-    bool isTouchingViewEdge(Latte::View *view, const QRect &windowgeometry);
+    bool isActiveInViewScreen(TrackedViewInfo *info, const WindowInfoWrap &winfo);
+    bool isMaximizedInViewScreen(TrackedViewInfo *info, const WindowInfoWrap &winfo);
+    bool isTouchingView(TrackedViewInfo *info, const WindowSystem::WindowInfoWrap &winfo);
+    bool isTouchingViewEdge(TrackedViewInfo *info, const WindowInfoWrap &winfo);
+    bool isTouchingViewEdge(TrackedViewInfo *info, const QRect &windowgeometry);
 
 private:
     //! a timer in order to not overload the views extra hints checking because it is not
@@ -168,6 +214,9 @@ private:
     QHash<Latte::View *, TrackedViewInfo *> m_views;
     QHash<Latte::Layout::GenericLayout *, TrackedLayoutInfo *> m_layouts;
 
+    QList<TrackedViewInfo *> m_detachedViews;
+    QList<TrackedLayoutInfo *> m_detachedLayouts;
+
     //! Accept only ALWAYSVISIBLE visibility mode
     QList<Latte::Types::Visibility> m_ignoreModes{
         Latte::Types::AutoHide,
@@ -182,6 +231,7 @@ private:
     };
 
     QMap<WindowId, WindowInfoWrap> m_windows;
+    WindowsHistory m_history;
 
     QTimer m_updateAllHintsTimer;
     //! Some applications delay their application name/icon identification
@@ -190,6 +240,9 @@ private:
     QTimer m_updateApplicationDataTimer;
     QList<WindowId> m_delayedApplicationData;
     QList<WindowId> m_initializedApplicationData;
+
+    //! application identification runs in a worker thread
+    Applications *m_applications{nullptr};
 };
 
 }
@@ -139,6 +139,11 @@ void WaylandInterface::initWindowManagement(KWayland::Client::PlasmaWindowManage
 
     m_windowManagement = windowManagement;
 
+    for (auto w : m_windowManagement->windows()) {
+        indexWindow(w);
+    }
+
+    connect(m_windowManagement, &PlasmaWindowManagement::windowCreated, this, &WaylandInterface::indexWindow);
     connect(m_windowManagement, &PlasmaWindowManagement::windowCreated, this, &WaylandInterface::windowCreatedProxy);
     connect(m_windowManagement, &PlasmaWindowManagement::activeWindowChanged, this, [&]() noexcept {
         auto w = m_windowManagement->activeWindow();
@@ -566,8 +571,7 @@ AppData WaylandInterface::appDataFor(WindowId wid)
     auto window = windowFor(wid);
 
     if (window) {
-        const AppData &data = appDataFromUrl(windowUrlFromMetadata(window->appId(),
-                                                                   window->pid(), rulesConfig));
+        const AppData &data = appDataFromUrl(Tracker::Applications::windowUrl(applicationMetadataFor(wid), rulesConfig));
 
         return data;
     }
@@ -577,17 +581,25 @@ AppData WaylandInterface::appDataFor(WindowId wid)
     return empty;
 }
 
-KWayland::Client::PlasmaWindow *WaylandInterface::windowFor(WindowId wid)
+ApplicationMetadata WaylandInterface::applicationMetadataFor(WindowId wid)
 {
-    auto it = std::find_if(m_windowManagement->windows().constBegin(), m_windowManagement->windows().constEnd(), [&wid](PlasmaWindow * w) noexcept {
-            return w->isValid() && w->internalId() == wid;
-});
+    ApplicationMetadata metadata;
+
+    auto window = windowFor(wid);
 
-    if (it == m_windowManagement->windows().constEnd()) {
-        return nullptr;
+    if (window) {
+        metadata.appId = window->appId();
+        metadata.pid = window->pid();
     }
 
-    return *it;
+    return metadata;
+}
+
+KWayland::Client::PlasmaWindow *WaylandInterface::windowFor(WindowId wid)
+{
+    auto w = m_windows.value(wid.toUInt(), nullptr);
+
+    return (w && w->isValid()) ? w : nullptr;
 }
 
 QIcon WaylandInterface::iconFor(WindowId wid)
@@ -604,28 +616,24 @@ QIcon WaylandInterface::iconFor(WindowId wid)
 
 WindowId WaylandInterface::winIdFor(QString appId, QString title)
 {
-    auto it = std::find_if(m_windowManagement->windows().constBegin(), m_windowManagement->windows().constEnd(), [&appId, &title](PlasmaWindow * w) noexcept {
-        return w->isValid() && w->appId() == appId && w->title().startsWith(title);
-    });
-
-    if (it == m_windowManagement->windows().constEnd()) {
-        return QVariant();
+    for (auto it = m_windowsByAppId.constFind(appId); it != m_windowsByAppId.constEnd() && it.key() == appId; ++it) {
+        if ((*it)->isValid() && (*it)->title().startsWith(title)) {
+            return (*it)->internalId();
+        }
     }
 
-    return (*it)->internalId();
+    return QVariant();
 }
 
 WindowId WaylandInterface::winIdFor(QString appId, QRect geometry)
 {
-    auto it = std::find_if(m_windowManagement->windows().constBegin(), m_windowManagement->windows().constEnd(), [&appId, &geometry](PlasmaWindow * w) noexcept {
-        return w->isValid() && w->appId() == appId && w->geometry() == geometry;
-    });
-
-    if (it == m_windowManagement->windows().constEnd()) {
-        return QVariant();
+    for (auto it = m_windowsByAppId.constFind(appId); it != m_windowsByAppId.constEnd() && it.key() == appId; ++it) {
+        if ((*it)->isValid() && (*it)->geometry() == geometry) {
+            return (*it)->internalId();
+        }
     }
 
-    return (*it)->internalId();
+    return QVariant();
 }
 
 bool WaylandInterface::windowCanBeDragged(WindowId wid)
@@ -866,7 +874,55 @@ void WaylandInterface::updateWindow()
     PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(QObject::sender());
 
     if (isValidWindow(pW)) {
-        considerWindowChanged(pW->internalId());
+        considerPlasmaWindowChanged(pW, true);
+    }
+}
+
+void WaylandInterface::updateWindowTitle()
+{
+    PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(QObject::sender());
+
+    //! titles are irrelevant to windows tracking hints such as dodge or touching,
+    //! only the window information needs to be updated for them
+    if (isValidWindow(pW)) {
+        considerPlasmaWindowChanged(pW, false);
+    }
+}
+
+void WaylandInterface::updateWindowIcon()
+{
+    PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(QObject::sender());
+
+    if (isValidWindow(pW)) {
+        emit windowIconChanged(pW->internalId());
+    }
+}
+
+void WaylandInterface::considerPlasmaWindowChanged(KWayland::Client::PlasmaWindow *w, bool hintsRelevant)
+{
+    //! a window usually sends many changes together e.g. geometry, maximized and active,
+    //! they are collected until the current wayland events dispatch has finished
+    const quint32 id = w->internalId();
+    m_windowsChangedInDispatch[id] = m_windowsChangedInDispatch.value(id, false) || hintsRelevant;
+
+    if (!m_windowsChangedFlushQueued) {
+        m_windowsChangedFlushQueued = true;
+        QMetaObject::invokeMethod(this, &WaylandInterface::flushPlasmaWindowsChanged, Qt::QueuedConnection);
+    }
+}
+
+void WaylandInterface::flushPlasmaWindowsChanged()
+{
+    m_windowsChangedFlushQueued = false;
+
+    const QHash<quint32, bool> changed = m_windowsChangedInDispatch;
+    m_windowsChangedInDispatch.clear();
+
+    for (auto it = changed.constBegin(); it != changed.constEnd(); ++it) {
+        //! windows can be unmapped in the meantime
+        if (m_windows.contains(it.key())) {
+            considerWindowChanged(it.key(), it.value());
+        }
     }
 }
 
@@ -876,6 +932,7 @@ void WaylandInterface::windowUnmapped()
 
     if (pW) {
         untrackWindow(pW);
+        m_windowsChangedInDispatch.remove(pW->internalId());
         emit windowRemoved(pW->internalId());
     }
 }
@@ -887,7 +944,8 @@ void WaylandInterface::trackWindow(KWayland::Client::PlasmaWindow *w)
     }
 
     connect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindow);
+    connect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindowTitle);
+    connect(w, &PlasmaWindow::iconChanged, this, &WaylandInterface::updateWindowIcon);
     connect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindow);
     connect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindow);
     connect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindow);
@@ -910,7 +968,8 @@ void WaylandInterface::untrackWindow(KWayland::Client::PlasmaWindow *w)
     }
 
     disconnect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindow);
+    disconnect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindowTitle);
+    disconnect(w, &PlasmaWindow::iconChanged, this, &WaylandInterface::updateWindowIcon);
     disconnect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindow);
     disconnect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindow);
     disconnect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindow);
@@ -926,6 +985,52 @@ void WaylandInterface::untrackWindow(KWayland::Client::PlasmaWindow *w)
     disconnect(w, &PlasmaWindow::unmapped, this, &WaylandInterface::windowUnmapped);
 }
 
+void WaylandInterface::indexWindow(KWayland::Client::PlasmaWindow *w)
+{
+    if (!w || m_windowAppIds.contains(w)) {
+        return;
+    }
+
+    m_windows[w->internalId()] = w;
+    updateWindowAppIdIndex(w);
+
+    connect(w, &PlasmaWindow::appIdChanged, this, [this, w]() {
+        updateWindowAppIdIndex(w);
+    });
+    connect(w, &PlasmaWindow::unmapped, this, [this, w]() {
+        unindexWindow(w);
+    });
+    connect(w, &QObject::destroyed, this, [this, w]() {
+        unindexWindow(w);
+    });
+}
+
+void WaylandInterface::unindexWindow(KWayland::Client::PlasmaWindow *w)
+{
+    if (!m_windowAppIds.contains(w)) {
+        return;
+    }
+
+    //! internalId() can not be used from destroyed signal
+    for (auto it = m_windows.begin(); it != m_windows.end(); ++it) {
+        if (it.value() == w) {
+            m_windows.erase(it);
+            break;
+        }
+    }
+
+    m_windowsByAppId.remove(m_windowAppIds.take(w), w);
+}
+
+void WaylandInterface::updateWindowAppIdIndex(KWayland::Client::PlasmaWindow *w)
+{
+    if (m_windowAppIds.contains(w)) {
+        m_windowsByAppId.remove(m_windowAppIds[w], w);
+    }
+
+    m_windowAppIds[w] = w->appId();
+    m_windowsByAppId.insert(w->appId(), w);
+}
 
 void WaylandInterface::windowCreatedProxy(KWayland::Client::PlasmaWindow *w)
 {
@@ -13,7 +13,9 @@
 #include "windowinfowrap.h"
 
 // Qt
+#include <QHash>
 #include <QMap>
+#include <QMultiHash>
 #include <QObject>
 
 // KDE
@@ -78,6 +80,7 @@ public:
     WindowId winIdFor(QString appId, QString title) override;
 
     AppData appDataFor(WindowId wid) override;
+    ApplicationMetadata applicationMetadataFor(WindowId wid) override;
 
     void setActiveEdge(QWindow *view, bool active)  override;
 
@@ -98,6 +101,8 @@ public:
 
 private slots:
     void updateWindow();
+    void updateWindowTitle();
+    void updateWindowIcon();
     void windowUnmapped();
 
 private:
@@ -111,6 +116,13 @@ private:
     void trackWindow(KWayland::Client::PlasmaWindow *w);
     void untrackWindow(KWayland::Client::PlasmaWindow *w);
 
+    void indexWindow(KWayland::Client::PlasmaWindow *w);
+    void unindexWindow(KWayland::Client::PlasmaWindow *w);
+    void updateWindowAppIdIndex(KWayland::Client::PlasmaWindow *w);
+
+    void considerPlasmaWindowChanged(KWayland::Client::PlasmaWindow *w, bool hintsRelevant);
+    void flushPlasmaWindowsChanged();
+
     KWayland::Client::PlasmaWindow *windowFor(WindowId wid);
     KWayland::Client::PlasmaShell *waylandCoronaInterface() const;
 
@@ -125,6 +137,18 @@ private:
 
     KWayland::Client::PlasmaWindowManagement *m_windowManagement{nullptr};
 
+    //! internalId -> window, all windows of window management are indexed
+    //! and not only the tracked ones
+    QHash<quint32, KWayland::Client::PlasmaWindow *> m_windows;
+    //! appId -> windows and window -> its indexed appId
+    QMultiHash<QString, KWayland::Client::PlasmaWindow *> m_windowsByAppId;
+    QHash<KWayland::Client::PlasmaWindow *, QString> m_windowAppIds;
+
+    //! windows that changed during the current wayland events dispatch,
+    //! value is true when the change can affect windows tracking hints
+    QHash<quint32, bool> m_windowsChangedInDispatch;
+    bool m_windowsChangedFlushQueued{false};
+
     //! VirtualDesktopsSupport
     KWayland::Client::PlasmaVirtualDesktopManagement *m_virtualDesktopManagement{nullptr};
     QStringList m_desktops;
@@ -496,42 +496,20 @@ WindowInfoWrap XWindowInterface::requestInfo(WindowId wid)
 
 AppData XWindowInterface::appDataFor(WindowId wid)
 {
-    return appDataFromUrl(windowUrl(wid));
+    return appDataFromUrl(Tracker::Applications::windowUrl(applicationMetadataFor(wid), rulesConfig));
 }
 
-QUrl XWindowInterface::windowUrl(WindowId wid)
+ApplicationMetadata XWindowInterface::applicationMetadataFor(WindowId wid)
 {
     const KWindowInfo info(wid.value<WId>(), 0, NET::WM2WindowClass | NET::WM2DesktopFileName);
 
-    QString desktopFile = QString::fromUtf8(info.desktopFileName());
+    ApplicationMetadata metadata;
+    metadata.appId = info.windowClassClass();
+    metadata.wmClassName = info.windowClassName();
+    metadata.desktopFileName = QString::fromUtf8(info.desktopFileName());
+    metadata.pid = NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid();
 
-    if (!desktopFile.isEmpty()) {
-        KService::Ptr service = KService::serviceByStorageId(desktopFile);
-
-        if (service) {
-            const QString &menuId = service->menuId();
-
-            // applications: URLs are used to refer to applications by their KService::menuId
-            // (i.e. .desktop file name) rather than the absolute path to a .desktop file.
-            if (!menuId.isEmpty()) {
-                return QUrl(QStringLiteral("applications:") + menuId);
-            }
-
-            return QUrl::fromLocalFile(service->entryPath());
-        }
-
-        if (!desktopFile.endsWith(QLatin1String(".desktop"))) {
-            desktopFile.append(QLatin1String(".desktop"));
-        }
-
-        if (KDesktopFile::isDesktopFile(desktopFile) && QFile::exists(desktopFile)) {
-            return QUrl::fromLocalFile(desktopFile);
-        }
-    }
-
-    return windowUrlFromMetadata(info.windowClassClass(),
-                                 NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid(),
-                                 rulesConfig, info.windowClassName());
+    return metadata;
 }
 
 bool XWindowInterface::windowCanBeDragged(WindowId wid)
@@ -561,14 +539,49 @@ QIcon XWindowInterface::iconFor(WindowId wid)
 {
     QIcon icon;
 
-    icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeSmall, KIconLoader::SizeSmall, false));
-    icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeSmallMedium, KIconLoader::SizeSmallMedium, false));
-    icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeMedium, KIconLoader::SizeMedium, false));
-    icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeLarge, KIconLoader::SizeLarge, false));
+    //! _NET_WM_ICON is fetched once and its images are scaled only on demand
+    for (const auto &image : iconImagesLoaderFor(wid)()) {
+        icon.addPixmap(QPixmap::fromImage(image));
+    }
+
+    if (icon.isNull()) {
+        //! windows without _NET_WM_ICON, KWindowSystem falls back to WM hints and class icons
+        icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeSmall, KIconLoader::SizeSmall, false));
+        icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeSmallMedium, KIconLoader::SizeSmallMedium, false));
+        icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeMedium, KIconLoader::SizeMedium, false));
+        icon.addPixmap(KWindowSystem::icon(wid.value<WId>(), KIconLoader::SizeLarge, KIconLoader::SizeLarge, false));
+    }
 
     return icon;
 }
 
+IconImagesLoader XWindowInterface::iconImagesLoaderFor(WindowId wid)
+{
+    //! xcb connections can be used from any thread
+    xcb_connection_t *connection = QX11Info::connection();
+    xcb_window_t rootWindow = QX11Info::appRootWindow();
+    xcb_window_t window = wid.value<WId>();
+
+    return [connection, rootWindow, window]() {
+        QList<QImage> images;
+
+        NETWinInfo info(connection, window, rootWindow, NET::WMIcon, NET::Properties2());
+        const int *sizes = info.iconSizes();
+
+        for (int i=0; sizes && (sizes[i] > 0 || sizes[i+1] > 0); i+=2) {
+            NETIcon icon = info.icon(sizes[i], sizes[i+1]);
+
+            if (icon.data && icon.size.width > 0 && icon.size.height > 0) {
+                QImage image(icon.data, icon.size.width, icon.size.height, QImage::Format_ARGB32);
+                //! the image data belong to NETWinInfo
+                images << image.copy();
+            }
+        }
+
+        return images;
+    };
+}
+
 WindowId XWindowInterface::winIdFor(QString appId, QRect geometry)
 {
     return activeWindow();
@@ -804,6 +817,10 @@ void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::P
         return;
     }
 
+    if (prop1 & NET::WMIcon) {
+        emit windowIconChanged(wid);
+    }
+
     //! accept only the following NET:Properties changed signals
     //! NET::WMState, NET::WMGeometry, NET::ActiveWindow
     if ( !(prop1 & NET::WMState)
@@ -815,7 +832,10 @@ void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::P
         return;
     }
 
-    considerWindowChanged(wid);
+    //! title changes are irrelevant to tracking hints
+    bool hintsRelevant = (prop1 & (NET::WMState | NET::WMGeometry | NET::ActiveWindow));
+
+    considerWindowChanged(wid, hintsRelevant);
 }
 
 }
@@ -59,9 +59,11 @@ public:
     bool windowCanBeMaximized(WindowId wid) override;
 
     QIcon iconFor(WindowId wid) override;
+    IconImagesLoader iconImagesLoaderFor(WindowId wid) override;
     WindowId winIdFor(QString appId, QRect geometry) override;
     WindowId winIdFor(QString appId, QString title) override;
     AppData appDataFor(WindowId wid) override;
+    ApplicationMetadata applicationMetadataFor(WindowId wid) override;
 
     void setActiveEdge(QWindow *view, bool active) override;
 
@@ -80,8 +82,6 @@ private:
     void windowAddedProxy(WId wid);
     void windowChangedProxy(WId wid, NET::Properties prop1, NET::Properties2 prop2);
 
-    QUrl windowUrl(WindowId wid);
-
     void checkShapeExtension();
 
 private:
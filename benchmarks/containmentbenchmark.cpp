@@ -0,0 +1,356 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "plugin/layoutmanager.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QQmlContext>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickView>
+#include <QSignalSpy>
+#include <QTest>
+
+// KDE
+#include <KCoreConfigSkeleton>
+#include <KDeclarative/ConfigPropertyMap>
+#include <KPluginMetaData>
+#include <KSharedConfig>
+
+// Plasma
+#include <Plasma>
+#include <Plasma/Applet>
+#include <PlasmaQuick/AppletQuickItem>
+
+#define FRAMETIMEOUT 1000
+#define SWEEPSTEP 4
+#define APPLETSROUNDS 10
+
+using Latte::Containment::LayoutManager;
+
+//! applets as the containment sees them, the applet id is provided
+//! the same way the plasma applet interface does
+class BenchmarkApplet : public PlasmaQuick::AppletQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(int id READ id CONSTANT)
+
+public:
+    BenchmarkApplet(Plasma::Applet *applet)
+        : PlasmaQuick::AppletQuickItem(applet)
+    {
+        applet->setParent(this);
+    }
+
+    int id() const
+    {
+        return applet()->id();
+    }
+};
+
+//! the plasmoid properties that the containment layout manager is using
+class BenchmarkPlasmoid : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QObject *configuration READ configuration CONSTANT)
+    Q_PROPERTY(int formFactor READ formFactor CONSTANT)
+    Q_PROPERTY(QList<QObject *> applets READ applets CONSTANT)
+
+public:
+    BenchmarkPlasmoid(QObject *parent = nullptr)
+        : QObject(parent),
+          m_skeleton(KSharedConfig::openConfig(QString(), KConfig::SimpleConfig))
+    {
+        m_skeleton.addItemInt(QStringLiteral("alignment"), m_alignment, 0);
+        m_skeleton.addItemInt(QStringLiteral("splitterPosition"), m_splitterPosition, -1);
+        m_skeleton.addItemInt(QStringLiteral("splitterPosition2"), m_splitterPosition2, -1);
+        m_skeleton.addItemString(QStringLiteral("appletOrder"), m_appletOrder);
+        m_skeleton.addItemString(QStringLiteral("lockedZoomApplets"), m_lockedZoomApplets);
+        m_skeleton.addItemString(QStringLiteral("userBlocksColorizingApplets"), m_userBlocksColorizingApplets);
+
+        m_skeleton.load();
+        m_configuration = new KDeclarative::ConfigPropertyMap(&m_skeleton, this);
+    }
+
+    ~BenchmarkPlasmoid() override
+    {
+        //! configuration is saved on destruction and it must not outlive its skeleton
+        delete m_configuration;
+    }
+
+    QObject *configuration() const
+    {
+        return m_configuration;
+    }
+
+    int formFactor() const
+    {
+        return Plasma::Types::Horizontal;
+    }
+
+    QList<QObject *> applets() const
+    {
+        return QList<QObject *>();
+    }
+
+private:
+    int m_alignment{0};
+    int m_splitterPosition{-1};
+    int m_splitterPosition2{-1};
+    QString m_appletOrder;
+    QString m_lockedZoomApplets;
+    QString m_userBlocksColorizingApplets;
+
+    KCoreConfigSkeleton m_skeleton;
+    KDeclarative::ConfigPropertyMap *m_configuration{nullptr};
+};
+
+//! Loads a dock scene on the offscreen platform with the software scene graph and measures
+//! the user facing paths that are heavier, parabolic sweeps and applets additions/removals.
+//! Timings include presenting the next frame, same as the profiler latency events.
+class ContainmentBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void cleanup();
+
+    void parabolicSweep_data();
+    void parabolicSweep();
+    void addApplets_data();
+    void addApplets();
+    void removeApplets_data();
+    void removeApplets();
+
+private:
+    void appletsCountData();
+
+    void createApplets(int count);
+    void destroyApplets();
+
+    bool waitForFrame();
+    //! returns the frames that were presented during the sweep
+    int sweep();
+
+    int sceneChanges() const;
+
+private:
+    uint m_lastAppletId{0};
+
+    QQuickView *m_view{nullptr};
+    QPointer<LayoutManager> m_layoutManager;
+    BenchmarkPlasmoid *m_plasmoid{nullptr};
+
+    QList<BenchmarkApplet *> m_applets;
+};
+
+void ContainmentBenchmark::initTestCase()
+{
+    //! frames are presented as soon as they are requested
+    qputenv("QT_QPA_UPDATE_IDLE_TIME", "0");
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+
+    qmlRegisterType<LayoutManager>("org.kde.latte.benchmarks", 0, 1, "LayoutManager");
+
+    m_plasmoid = new BenchmarkPlasmoid(this);
+
+    m_view = new QQuickView();
+    m_view->rootContext()->setContextProperty(QStringLiteral("benchmarkPlasmoid"), m_plasmoid);
+    m_view->setResizeMode(QQuickView::SizeRootObjectToView);
+    m_view->setSource(QUrl::fromLocalFile(QStringLiteral(BENCHMARKSDIR "/containmentbenchmark.qml")));
+
+    QString errors;
+
+    for (const auto &error : m_view->errors()) {
+        errors += error.toString() + QLatin1Char('\n');
+    }
+
+    QVERIFY2(m_view->status() == QQuickView::Ready, qPrintable(errors));
+
+    m_layoutManager = m_view->rootObject()->findChild<LayoutManager *>();
+    QVERIFY(m_layoutManager);
+
+    m_view->resize(1920, 100);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+}
+
+void ContainmentBenchmark::cleanupTestCase()
+{
+    delete m_view;
+    m_view = nullptr;
+}
+
+void ContainmentBenchmark::cleanup()
+{
+    destroyApplets();
+}
+
+void ContainmentBenchmark::appletsCountData()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 applets") << 10;
+    QTest::newRow("40 applets") << 40;
+    QTest::newRow("100 applets") << 100;
+}
+
+int ContainmentBenchmark::sceneChanges() const
+{
+    return m_view->rootObject()->property("sceneChanges").toInt();
+}
+
+bool ContainmentBenchmark::waitForFrame()
+{
+    QSignalSpy frames(m_view, &QQuickWindow::frameSwapped);
+    m_view->update();
+    return frames.wait(FRAMETIMEOUT);
+}
+
+void ContainmentBenchmark::createApplets(int count)
+{
+    for (int i = 0; i < count; ++i) {
+        Plasma::Applet *applet = new Plasma::Applet(KPluginMetaData(), nullptr, ++m_lastAppletId);
+        BenchmarkApplet *appletItem = new BenchmarkApplet(applet);
+        m_applets << appletItem;
+
+        //! same as Containment.onAppletAdded when an applet is added at the end
+        m_layoutManager->addAppletItem(appletItem, m_layoutManager->order().count());
+    }
+}
+
+void ContainmentBenchmark::destroyApplets()
+{
+    for (const auto appletItem : m_applets) {
+        m_layoutManager->removeAppletItem(appletItem);
+    }
+
+    //! applet containers are released with deleteLater
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    qDeleteAll(m_applets);
+    m_applets.clear();
+}
+
+int ContainmentBenchmark::sweep()
+{
+    QSignalSpy frames(m_view, &QQuickWindow::frameSwapped);
+    const int y = m_view->height() - 24;
+
+    for (int x = 0; x < m_view->width(); x += SWEEPSTEP) {
+        const int changes = sceneChanges();
+
+        QTest::mouseMove(m_view, QPoint(x, y));
+        QCoreApplication::processEvents();
+
+        //! the frame for this mouse step is presented before the next step
+        if (changes != sceneChanges()) {
+            frames.wait(FRAMETIMEOUT);
+        }
+    }
+
+    const int changes = sceneChanges();
+    QEvent leave(QEvent::Leave);
+    QCoreApplication::sendEvent(m_view, &leave);
+
+    if (changes != sceneChanges()) {
+        frames.wait(FRAMETIMEOUT);
+    }
+
+    return frames.count();
+}
+
+void ContainmentBenchmark::parabolicSweep_data()
+{
+    appletsCountData();
+}
+
+void ContainmentBenchmark::parabolicSweep()
+{
+    QFETCH(int, count);
+
+    createApplets(count);
+    QCOMPARE(m_layoutManager->appletOrder().count(), count);
+    QVERIFY(waitForFrame());
+
+    int sweeps{0};
+    int frames{0};
+
+    //! the mouse moves along the dock from the left screen edge to the right one
+    QBENCHMARK {
+        frames += sweep();
+        ++sweeps;
+    }
+
+    qInfo() << "frames per sweep:" << (sweeps > 0 ? frames / sweeps : 0);
+}
+
+void ContainmentBenchmark::addApplets_data()
+{
+    appletsCountData();
+}
+
+void ContainmentBenchmark::addApplets()
+{
+    QFETCH(int, count);
+
+    qint64 elapsed{0};
+
+    //! only the additions are timed, until the new layout is presented
+    for (int round = 0; round < APPLETSROUNDS; ++round) {
+        QElapsedTimer timer;
+        timer.start();
+
+        createApplets(count);
+        QVERIFY(waitForFrame());
+
+        elapsed += timer.nsecsElapsed();
+
+        QCOMPARE(m_layoutManager->appletOrder().count(), count);
+        destroyApplets();
+        QVERIFY(waitForFrame());
+    }
+
+    QTest::setBenchmarkResult(elapsed / APPLETSROUNDS / 1000000.0, QTest::WalltimeMilliseconds);
+}
+
+void ContainmentBenchmark::removeApplets_data()
+{
+    appletsCountData();
+}
+
+void ContainmentBenchmark::removeApplets()
+{
+    QFETCH(int, count);
+
+    qint64 elapsed{0};
+
+    //! only the removals are timed, until the new layout is presented
+    for (int round = 0; round < APPLETSROUNDS; ++round) {
+        createApplets(count);
+        QVERIFY(waitForFrame());
+
+        QElapsedTimer timer;
+        timer.start();
+
+        destroyApplets();
+        QVERIFY(waitForFrame());
+
+        elapsed += timer.nsecsElapsed();
+
+        QCOMPARE(m_layoutManager->appletOrder().count(), 0);
+    }
+
+    QTest::setBenchmarkResult(elapsed / APPLETSROUNDS / 1000000.0, QTest::WalltimeMilliseconds);
+}
+
+QTEST_MAIN(ContainmentBenchmark)
+
+#include "containmentbenchmark.moc"
@@ -0,0 +1,210 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+import QtQuick 2.8
+
+import org.kde.latte.benchmarks 0.1 as LatteBenchmarks
+
+import "../declarativeimports/abilities/definition" as AbilityDefinition
+
+//! A horizontal dock with the containment layouts, applets are added and removed
+//! through the containment LayoutManager and they are zoomed through the parabolic
+//! effect definition. Applet containers follow the messages protocol of the
+//! containment applet/ParabolicArea.qml
+Item {
+    id: root
+    width: 1920
+    height: 100
+
+    readonly property int appletsCount: layoutManager.appletOrder.length
+    readonly property int iconSize: Math.min(48, Math.floor((width - 100) / Math.max(1, appletsCount)))
+
+    //! it is increased on every visual change of the applets and it is used
+    //! to find out whether a new frame is expected
+    property int sceneChanges: 0
+
+    readonly property Item parabolic: AbilityDefinition.ParabolicEffect {
+        isEnabled: true
+    }
+
+    function createAppletItem(applet) {
+        var appletContainer = appletContainerComponent.createObject(dndSpacer.parent);
+        initAppletContainer(appletContainer, applet);
+        return appletContainer;
+    }
+
+    function initAppletContainer(appletContainer, applet) {
+        appletContainer.applet = applet;
+        applet.parent = appletContainer.appletWrapper;
+        applet.anchors.fill = appletContainer.appletWrapper;
+        applet.visible = true;
+    }
+
+    function createJustifySplitter() {
+        var splitter = appletContainerComponent.createObject(root);
+        splitter.isInternalViewSplitter = true;
+        return splitter;
+    }
+
+    //! clears zoom when the mouse leaves the dock
+    MouseArea {
+        anchors.fill: parent
+        hoverEnabled: true
+        acceptedButtons: Qt.NoButton
+        onExited: root.parabolic.sglClearZoom();
+    }
+
+    Row {
+        id: startLayout
+        anchors.left: parent.left
+        anchors.bottom: parent.bottom
+    }
+
+    Row {
+        id: mainLayout
+        anchors.horizontalCenter: parent.horizontalCenter
+        anchors.bottom: parent.bottom
+
+        property Item startParabolicSpacer: null
+        property Item endParabolicSpacer: null
+    }
+
+    Row {
+        id: endLayout
+        anchors.right: parent.right
+        anchors.bottom: parent.bottom
+    }
+
+    Item {
+        id: dndSpacer
+        width: 0
+        height: 0
+    }
+
+    LatteBenchmarks.LayoutManager {
+        id: layoutManager
+        plasmoidObj: benchmarkPlasmoid
+        rootItem: root
+        dndSpacerItem: dndSpacer
+        mainLayout: mainLayout
+        startLayout: startLayout
+        endLayout: endLayout
+    }
+
+    Component {
+        id: appletContainerComponent
+
+        Item {
+            id: appletContainer
+            width: root.iconSize * zoom
+            height: width
+
+            property bool isInternalViewSplitter: false
+            property Item applet: null
+            property real zoom: 1
+
+            readonly property alias appletWrapper: _wrapper
+            readonly property int index: {
+                if (!parent) {
+                    return -1;
+                }
+
+                var children = parent.children;
+
+                for (var i=0; i<children.length; ++i) {
+                    if (children[i] === appletContainer) {
+                        return i;
+                    }
+                }
+
+                return -1;
+            }
+
+            onZoomChanged: root.sceneChanges++;
+
+            Rectangle {
+                anchors.fill: parent
+                anchors.margins: 2
+                radius: 4
+                color: appletContainer.zoom > 1 ? "steelblue" : "slategray"
+            }
+
+            Item {
+                id: _wrapper
+                anchors.fill: parent
+            }
+
+            MouseArea {
+                anchors.fill: parent
+                hoverEnabled: true
+                acceptedButtons: Qt.NoButton
+
+                onEntered: appletContainer.calculateParabolicScales(mouseX);
+                onPositionChanged: appletContainer.calculateParabolicScales(mouse.x);
+            }
+
+            function calculateParabolicScales(currentMousePosition) {
+                root.parabolic.applyParabolicEffect(index, currentMousePosition, root.iconSize * zoom);
+                zoom = root.parabolic.factor.zoom;
+            }
+
+            function updateScale(nIndex, nScale) {
+                if (index === nIndex) {
+                    zoom = Math.max(1, nScale);
+                }
+            }
+
+            function sltUpdateItemScale(delegateIndex, newScales, islower) {
+                var clearrequestedfromlastacceptedsignal = (newScales.length===1) && (newScales[0]===1);
+                var sideindex = islower ? index-1 : index+1;
+
+                if (delegateIndex === index) {
+                    if (newScales.length <= 0) {
+                        return;
+                    }
+
+                    var nextscales = newScales.slice();
+                    updateScale(delegateIndex, nextscales[0]);
+                    nextscales.splice(0,1);
+
+                    if (nextscales.length > 0) {
+                        if (islower) {
+                            root.parabolic.sglUpdateLowerItemScale(sideindex, nextscales);
+                        } else {
+                            root.parabolic.sglUpdateHigherItemScale(sideindex, nextscales);
+                        }
+                    }
+                } else if ((islower && clearrequestedfromlastacceptedsignal && (index < delegateIndex))
+                           || (!islower && clearrequestedfromlastacceptedsignal && (index > delegateIndex))) {
+                    updateScale(index, 1);
+                }
+            }
+
+            function sltUpdateLowerItemScale(delegateIndex, newScales) {
+                sltUpdateItemScale(delegateIndex, newScales, true);
+            }
+
+            function sltUpdateHigherItemScale(delegateIndex, newScales) {
+                sltUpdateItemScale(delegateIndex, newScales, false);
+            }
+
+            function sltClearZoom() {
+                zoom = 1;
+            }
+
+            Component.onCompleted: {
+                root.parabolic.sglUpdateLowerItemScale.connect(sltUpdateLowerItemScale);
+                root.parabolic.sglUpdateHigherItemScale.connect(sltUpdateHigherItemScale);
+                root.parabolic.sglClearZoom.connect(sltClearZoom);
+            }
+
+            Component.onDestruction: {
+                root.parabolic.sglUpdateLowerItemScale.disconnect(sltUpdateLowerItemScale);
+                root.parabolic.sglUpdateHigherItemScale.disconnect(sltUpdateHigherItemScale);
+                root.parabolic.sglClearZoom.disconnect(sltClearZoom);
+            }
+        }
+    }
+}
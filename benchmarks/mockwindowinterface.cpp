@@ -0,0 +1,368 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "mockwindowinterface.h"
+
+// Qt
+#include <QPixmap>
+
+namespace Latte {
+namespace WindowSystem {
+
+MockWindowInterface::MockWindowInterface(QObject *parent)
+    : AbstractWindowInterface(parent)
+{
+    //! all windows share the same icon, this way icon changes are not reported
+    //! for windows that were already identified
+    for (const int size : {16, 22, 32, 48}) {
+        QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::darkCyan);
+        m_iconImages << image;
+        m_icon.addPixmap(QPixmap::fromImage(image));
+    }
+}
+
+MockWindowInterface::~MockWindowInterface()
+{
+}
+
+void MockWindowInterface::setViewExtraFlags(QObject *view, bool isPanelWindow, Latte::Types::Visibility mode)
+{
+    Q_UNUSED(view)
+    Q_UNUSED(isPanelWindow)
+    Q_UNUSED(mode)
+}
+
+void MockWindowInterface::setViewStruts(QWindow &view, const QRect &rect, Plasma::Types::Location location)
+{
+    Q_UNUSED(view)
+    Q_UNUSED(rect)
+    Q_UNUSED(location)
+}
+
+void MockWindowInterface::setWindowOnActivities(const WindowId &wid, const QStringList &activities)
+{
+    Q_UNUSED(wid)
+    Q_UNUSED(activities)
+}
+
+void MockWindowInterface::removeViewStruts(QWindow &view)
+{
+    Q_UNUSED(view)
+}
+
+WindowId MockWindowInterface::activeWindow()
+{
+    return m_activeWindow;
+}
+
+WindowInfoWrap MockWindowInterface::requestInfo(WindowId wid)
+{
+    return m_windows.value(wid.toInt());
+}
+
+WindowInfoWrap MockWindowInterface::requestInfoActive()
+{
+    return requestInfo(m_activeWindow);
+}
+
+void MockWindowInterface::skipTaskBar(const QDialog &dialog)
+{
+    Q_UNUSED(dialog)
+}
+
+void MockWindowInterface::slideWindow(QWindow &view, Slide location)
+{
+    Q_UNUSED(view)
+    Q_UNUSED(location)
+}
+
+void MockWindowInterface::enableBlurBehind(QWindow &view)
+{
+    Q_UNUSED(view)
+}
+
+void MockWindowInterface::setActiveEdge(QWindow *view, bool active)
+{
+    Q_UNUSED(view)
+    Q_UNUSED(active)
+}
+
+void MockWindowInterface::requestActivate(WindowId wid)
+{
+    activateWindow(wid);
+}
+
+void MockWindowInterface::requestClose(WindowId wid)
+{
+    destroyWindow(wid);
+}
+
+void MockWindowInterface::requestMoveWindow(WindowId wid, QPoint from)
+{
+    Q_UNUSED(wid)
+    Q_UNUSED(from)
+}
+
+void MockWindowInterface::requestToggleIsOnAllDesktops(WindowId wid)
+{
+    Q_UNUSED(wid)
+}
+
+void MockWindowInterface::requestToggleKeepAbove(WindowId wid)
+{
+    Q_UNUSED(wid)
+}
+
+void MockWindowInterface::requestToggleMinimized(WindowId wid)
+{
+    Q_UNUSED(wid)
+}
+
+void MockWindowInterface::requestToggleMaximized(WindowId wid)
+{
+    if (!m_windows.contains(wid.toInt())) {
+        return;
+    }
+
+    setMaximized(wid, !m_windows[wid.toInt()].isMaximized());
+}
+
+void MockWindowInterface::setKeepAbove(WindowId wid, bool active)
+{
+    Q_UNUSED(wid)
+    Q_UNUSED(active)
+}
+
+void MockWindowInterface::setKeepBelow(WindowId wid, bool active)
+{
+    Q_UNUSED(wid)
+    Q_UNUSED(active)
+}
+
+bool MockWindowInterface::windowCanBeDragged(WindowId wid)
+{
+    return m_windows.contains(wid.toInt());
+}
+
+bool MockWindowInterface::windowCanBeMaximized(WindowId wid)
+{
+    return m_windows.contains(wid.toInt());
+}
+
+QIcon MockWindowInterface::iconFor(WindowId wid)
+{
+    Q_UNUSED(wid)
+    return m_icon;
+}
+
+IconImagesLoader MockWindowInterface::iconImagesLoaderFor(WindowId wid)
+{
+    Q_UNUSED(wid)
+
+    //! the images are copied in order to be safe to use from worker threads
+    QList<QImage> images = m_iconImages;
+    return [images]() {
+        return images;
+    };
+}
+
+WindowId MockWindowInterface::winIdFor(QString appId, QRect geometry)
+{
+    for (auto i = m_windows.constBegin(); i != m_windows.constEnd(); ++i) {
+        if (m_appIds[i.key()] == appId && i.value().geometry() == geometry) {
+            return i.key();
+        }
+    }
+
+    return WindowId();
+}
+
+WindowId MockWindowInterface::winIdFor(QString appId, QString title)
+{
+    Q_UNUSED(title)
+
+    for (auto i = m_windows.constBegin(); i != m_windows.constEnd(); ++i) {
+        if (m_appIds[i.key()] == appId) {
+            return i.key();
+        }
+    }
+
+    return WindowId();
+}
+
+AppData MockWindowInterface::appDataFor(WindowId wid)
+{
+    AppData data;
+    data.id = m_appIds.value(wid.toInt());
+    data.name = data.id;
+    data.icon = m_icon;
+    return data;
+}
+
+ApplicationMetadata MockWindowInterface::applicationMetadataFor(WindowId wid)
+{
+    ApplicationMetadata metadata;
+    metadata.appId = m_appIds.value(wid.toInt());
+    metadata.wmClassName = metadata.appId;
+    return metadata;
+}
+
+void MockWindowInterface::switchToNextVirtualDesktop()
+{
+}
+
+void MockWindowInterface::switchToPreviousVirtualDesktop()
+{
+}
+
+void MockWindowInterface::setFrameExtents(QWindow *view, const QMargins &margins)
+{
+    Q_UNUSED(view)
+    Q_UNUSED(margins)
+}
+
+void MockWindowInterface::setInputMask(QWindow *window, const QRect &rect)
+{
+    Q_UNUSED(window)
+    Q_UNUSED(rect)
+}
+
+//! synthetic windows
+WindowId MockWindowInterface::createWindow(const QString &appId, const QRect &geometry)
+{
+    int id = m_nextWid++;
+
+    WindowInfoWrap winfo;
+    winfo.setWid(id);
+    winfo.setIsValid(true);
+    winfo.setIsOnAllDesktops(true);
+    winfo.setIsOnAllActivities(true);
+    winfo.setGeometry(geometry);
+
+    m_windows[id] = winfo;
+    m_appIds[id] = appId;
+
+    emit windowAdded(id);
+
+    return id;
+}
+
+void MockWindowInterface::destroyWindow(const WindowId &wid)
+{
+    int id = wid.toInt();
+
+    if (!m_windows.contains(id)) {
+        return;
+    }
+
+    m_windows.remove(id);
+    m_appIds.remove(id);
+    m_changedWindows.removeAll(wid);
+    m_changedInfoWindows.removeAll(wid);
+
+    if (m_activeWindow == wid) {
+        m_activeWindow = WindowId();
+    }
+
+    emit windowRemoved(id);
+}
+
+void MockWindowInterface::activateWindow(const WindowId &wid)
+{
+    int id = wid.toInt();
+
+    if (!m_windows.contains(id) || m_activeWindow == wid) {
+        return;
+    }
+
+    int previous = m_activeWindow.toInt();
+
+    if (m_windows.contains(previous)) {
+        m_windows[previous].setIsActive(false);
+    }
+
+    m_windows[id].setIsActive(true);
+    m_activeWindow = id;
+
+    emit activeWindowChanged(id);
+}
+
+void MockWindowInterface::moveWindow(const WindowId &wid, const QRect &geometry)
+{
+    int id = wid.toInt();
+
+    if (!m_windows.contains(id)) {
+        return;
+    }
+
+    m_windows[id].setGeometry(geometry);
+    addChangedWindow(id, true);
+}
+
+void MockWindowInterface::setMaximized(const WindowId &wid, bool maximized)
+{
+    int id = wid.toInt();
+
+    if (!m_windows.contains(id)) {
+        return;
+    }
+
+    m_windows[id].setIsMaxVert(maximized);
+    m_windows[id].setIsMaxHoriz(maximized);
+    addChangedWindow(id, true);
+}
+
+void MockWindowInterface::renameWindow(const WindowId &wid, const QString &title)
+{
+    int id = wid.toInt();
+
+    if (!m_windows.contains(id)) {
+        return;
+    }
+
+    m_windows[id].setDisplay(title);
+    addChangedWindow(id, false);
+}
+
+void MockWindowInterface::addChangedWindow(const WindowId &wid, bool hintsRelevant)
+{
+    QList<WindowId> &changed = hintsRelevant ? m_changedWindows : m_changedInfoWindows;
+
+    if (!changed.contains(wid)) {
+        changed << wid;
+    }
+}
+
+void MockWindowInterface::flushChangedWindows()
+{
+    //! the same batches that considerWindowChanged() sends, without waiting for its timer
+    QList<WindowId> wids = m_changedWindows;
+    QList<WindowId> infoWids = m_changedInfoWindows;
+    m_changedWindows.clear();
+    m_changedInfoWindows.clear();
+
+    if (!wids.isEmpty()) {
+        emit windowsChanged(wids);
+    }
+
+    if (!infoWids.isEmpty()) {
+        emit windowsInfoChanged(infoWids);
+    }
+}
+
+QList<WindowId> MockWindowInterface::windows() const
+{
+    QList<WindowId> wids;
+
+    for (const int id : m_windows.keys()) {
+        wids << id;
+    }
+
+    return wids;
+}
+
+}
+}
@@ -0,0 +1,107 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef MOCKWINDOWINTERFACE_H
+#define MOCKWINDOWINTERFACE_H
+
+// local
+#include "wm/abstractwindowinterface.h"
+#include "wm/windowinfowrap.h"
+
+// Qt
+#include <QHash>
+#include <QIcon>
+#include <QImage>
+#include <QObject>
+
+namespace Latte {
+namespace WindowSystem {
+
+//! window interface without any window system behind it, benchmarks create
+//! synthetic windows and replay their events through the real signals
+class MockWindowInterface : public AbstractWindowInterface
+{
+    Q_OBJECT
+
+public:
+    explicit MockWindowInterface(QObject *parent = nullptr);
+    ~MockWindowInterface() override;
+
+    void setViewExtraFlags(QObject *view, bool isPanelWindow = true, Latte::Types::Visibility mode = Latte::Types::WindowsGoBelow) override;
+    void setViewStruts(QWindow &view, const QRect &rect
+                       , Plasma::Types::Location location) override;
+    void setWindowOnActivities(const WindowId &wid, const QStringList &activities) override;
+
+    void removeViewStruts(QWindow &view) override;
+
+    WindowId activeWindow() override;
+    WindowInfoWrap requestInfo(WindowId wid) override;
+    WindowInfoWrap requestInfoActive() override;
+
+    void skipTaskBar(const QDialog &dialog) override;
+    void slideWindow(QWindow &view, Slide location) override;
+    void enableBlurBehind(QWindow &view) override;
+    void setActiveEdge(QWindow *view, bool active) override;
+
+    void requestActivate(WindowId wid) override;
+    void requestClose(WindowId wid) override;
+    void requestMoveWindow(WindowId wid, QPoint from) override;
+    void requestToggleIsOnAllDesktops(WindowId wid) override;
+    void requestToggleKeepAbove(WindowId wid) override;
+    void requestToggleMinimized(WindowId wid) override;
+    void requestToggleMaximized(WindowId wid) override;
+    void setKeepAbove(WindowId wid, bool active) override;
+    void setKeepBelow(WindowId wid, bool active) override;
+
+    bool windowCanBeDragged(WindowId wid) override;
+    bool windowCanBeMaximized(WindowId wid) override;
+
+    QIcon iconFor(WindowId wid) override;
+    IconImagesLoader iconImagesLoaderFor(WindowId wid) override;
+    WindowId winIdFor(QString appId, QRect geometry) override;
+    WindowId winIdFor(QString appId, QString title) override;
+    AppData appDataFor(WindowId wid) override;
+    ApplicationMetadata applicationMetadataFor(WindowId wid) override;
+
+    void switchToNextVirtualDesktop() override;
+    void switchToPreviousVirtualDesktop() override;
+
+    void setFrameExtents(QWindow *view, const QMargins &margins) override;
+    void setInputMask(QWindow *window, const QRect &rect) override;
+
+    //! synthetic windows, wids are increasing and they are never reused
+    WindowId createWindow(const QString &appId, const QRect &geometry);
+    void destroyWindow(const WindowId &wid);
+    void activateWindow(const WindowId &wid);
+    void moveWindow(const WindowId &wid, const QRect &geometry);
+    void setMaximized(const WindowId &wid, bool maximized);
+    void renameWindow(const WindowId &wid, const QString &title);
+
+    //! changed windows are sent as one batch, same as the real window interfaces do
+    void flushChangedWindows();
+
+    QList<WindowId> windows() const;
+
+private:
+    void addChangedWindow(const WindowId &wid, bool hintsRelevant);
+
+private:
+    int m_nextWid{1};
+    WindowId m_activeWindow;
+
+    QIcon m_icon;
+    QList<QImage> m_iconImages;
+
+    QHash<int, WindowInfoWrap> m_windows;
+    QHash<int, QString> m_appIds;
+
+    QList<WindowId> m_changedWindows;
+    QList<WindowId> m_changedInfoWindows;
+};
+
+}
+}
+
+#endif
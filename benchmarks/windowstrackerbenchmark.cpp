@@ -0,0 +1,421 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "mockwindowinterface.h"
+#include "wm/tracker/trackedlayoutinfo.h"
+#include "wm/tracker/trackedviewinfo.h"
+#include "wm/tracker/windowstracker.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QSignalSpy>
+#include <QTest>
+#include <QVector>
+
+// C++
+#include <algorithm>
+#include <numeric>
+
+#define IDENTIFICATIONTIMEOUT 5000
+#define WINDOWSPERAPPLICATION 4
+
+#define SCREENWIDTH 1920
+#define SCREENHEIGHT 1080
+#define VIEWTHICKNESS 64
+#define VIEWLENGTH 800
+
+//! streams are replayed a few times in order to collect enough events,
+//! batches are much fewer events so they are replayed more times
+#define STREAMROUNDS 5
+#define BATCHROUNDS 20
+
+using Latte::WindowSystem::MockWindowInterface;
+using Latte::WindowSystem::WindowId;
+using Latte::WindowSystem::Tracker::TrackedLayoutInfo;
+using Latte::WindowSystem::Tracker::TrackedViewInfo;
+
+//! Latencies of the events that are delivered to the tracker. Every event is handled
+//! synchronously, so its latency includes updateAllHints and the hints passes of all
+//! views and layouts. The mean latency is the benchmark result of the test function.
+class EventsMeter
+{
+public:
+    template<typename Event>
+    void record(Event event)
+    {
+        m_timer.start();
+        event();
+        m_latencies << m_timer.nsecsElapsed();
+    }
+
+    void report() const
+    {
+        if (m_latencies.isEmpty()) {
+            return;
+        }
+
+        QVector<qint64> latencies = m_latencies;
+        std::sort(latencies.begin(), latencies.end());
+
+        const qint64 total = std::max<qint64>(1, std::accumulate(latencies.constBegin(), latencies.constEnd(), qint64(0)));
+        const int count = latencies.count();
+        const qreal mean = qreal(total) / count;
+
+        qInfo("%s: %d events, %.0f events/s, latency mean %.1f us, p95 %.1f us, max %.1f us",
+              QTest::currentDataTag(),
+              count,
+              count * 1000000000.0 / total,
+              mean / 1000.0,
+              latencies[(count - 1) * 95 / 100] / 1000.0,
+              latencies.last() / 1000.0);
+
+        QTest::setBenchmarkResult(mean, QTest::WalltimeNanoseconds);
+    }
+
+private:
+    QElapsedTimer m_timer;
+    QVector<qint64> m_latencies;
+};
+
+//! Replays synthetic window streams through Tracker::Windows and reports how much
+//! each stream costs, e.g. windows of a busy session or a user switching windows fast.
+//! Views and layouts are registered as detached tracked views, so the hints passes
+//! run for them exactly as for real docks and panels in several screens
+class WindowsTrackerBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void addRemoveWindows_data();
+    void addRemoveWindows();
+    void activeWindowStream_data();
+    void activeWindowStream();
+    void moveWindowStream_data();
+    void moveWindowStream();
+    void windowsChangedBatch_data();
+    void windowsChangedBatch();
+    void windowsInfoChangedBatch_data();
+    void windowsInfoChangedBatch();
+    void applicationIdentification_data();
+    void applicationIdentification();
+
+private:
+    void windowsCountData();
+    void sessionsData();
+
+    QRect screenGeometry(int screen) const;
+    QRect windowGeometry(int index, int screens) const;
+
+    QList<WindowId> createWindows(MockWindowInterface &wm, int count, int screens = 1, const QString &appPrefix = QStringLiteral("app"));
+    QList<TrackedViewInfo *> addViews(MockWindowInterface &wm, int screens, int viewsPerScreen);
+    QList<TrackedLayoutInfo *> addLayouts(MockWindowInterface &wm, int layouts);
+};
+
+void WindowsTrackerBenchmark::windowsCountData()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("50 windows") << 50;
+    QTest::newRow("200 windows") << 200;
+    QTest::newRow("1000 windows") << 1000;
+}
+
+void WindowsTrackerBenchmark::sessionsData()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("screens");
+    QTest::addColumn<int>("viewsPerScreen");
+    QTest::addColumn<int>("layouts");
+
+    for (const int count : {50, 200, 1000}) {
+        //! a single dock and a multi-screen setup with a dock and two panels per screen
+        QTest::newRow(qPrintable(QStringLiteral("%1 windows, 1 screen, 1 view").arg(count))) << count << 1 << 1 << 1;
+        QTest::newRow(qPrintable(QStringLiteral("%1 windows, 3 screens, 9 views").arg(count))) << count << 3 << 3 << 2;
+    }
+}
+
+QRect WindowsTrackerBenchmark::screenGeometry(int screen) const
+{
+    //! screens are placed side by side
+    return QRect(screen * SCREENWIDTH, 0, SCREENWIDTH, SCREENHEIGHT);
+}
+
+QRect WindowsTrackerBenchmark::windowGeometry(int index, int screens) const
+{
+    //! windows are spread in all screens and some of them touch the views
+    const QRect screen = screenGeometry(index % screens);
+    return QRect(screen.x() + (index * 37) % 1600, (index * 23) % 800, 320, 240 + (index % 3) * 12);
+}
+
+QList<WindowId> WindowsTrackerBenchmark::createWindows(MockWindowInterface &wm, int count, int screens, const QString &appPrefix)
+{
+    QList<WindowId> wids;
+
+    for (int i = 0; i < count; ++i) {
+        wids << wm.createWindow(appPrefix + QString::number(i / WINDOWSPERAPPLICATION), windowGeometry(i, screens));
+    }
+
+    return wids;
+}
+
+QList<TrackedViewInfo *> WindowsTrackerBenchmark::addViews(MockWindowInterface &wm, int screens, int viewsPerScreen)
+{
+    QList<TrackedViewInfo *> views;
+
+    for (int i = 0; i < screens; ++i) {
+        const QRect screen = screenGeometry(i);
+
+        //! a bottom dock, a top panel and a left panel
+        const QList<QPair<Plasma::Types::Location, QRect>> geometries{
+            {Plasma::Types::BottomEdge, QRect(screen.x() + (SCREENWIDTH - VIEWLENGTH) / 2, screen.bottom() - VIEWTHICKNESS + 1, VIEWLENGTH, VIEWTHICKNESS)},
+            {Plasma::Types::TopEdge, QRect(screen.x(), screen.y(), SCREENWIDTH, VIEWTHICKNESS)},
+            {Plasma::Types::LeftEdge, QRect(screen.x(), screen.y() + VIEWTHICKNESS, VIEWTHICKNESS, SCREENHEIGHT - 2 * VIEWTHICKNESS)}
+        };
+
+        for (int j = 0; j < viewsPerScreen && j < geometries.count(); ++j) {
+            views << wm.windowsTracker()->addDetachedView(screen, geometries[j].second, geometries[j].first);
+        }
+    }
+
+    return views;
+}
+
+QList<TrackedLayoutInfo *> WindowsTrackerBenchmark::addLayouts(MockWindowInterface &wm, int layouts)
+{
+    QList<TrackedLayoutInfo *> infos;
+
+    for (int i = 0; i < layouts; ++i) {
+        infos << wm.windowsTracker()->addDetachedLayout();
+    }
+
+    return infos;
+}
+
+void WindowsTrackerBenchmark::addRemoveWindows_data()
+{
+    sessionsData();
+}
+
+void WindowsTrackerBenchmark::addRemoveWindows()
+{
+    QFETCH(int, count);
+    QFETCH(int, screens);
+    QFETCH(int, viewsPerScreen);
+    QFETCH(int, layouts);
+
+    MockWindowInterface wm;
+    addViews(wm, screens, viewsPerScreen);
+    addLayouts(wm, layouts);
+
+    EventsMeter meter;
+
+    for (int round = 0; round < STREAMROUNDS; ++round) {
+        QList<WindowId> wids;
+
+        for (int i = 0; i < count; ++i) {
+            meter.record([&]() {
+                wids << wm.createWindow(QStringLiteral("app") + QString::number(i / WINDOWSPERAPPLICATION), windowGeometry(i, screens));
+            });
+        }
+
+        for (const auto &wid : wids) {
+            meter.record([&]() {
+                wm.destroyWindow(wid);
+            });
+        }
+    }
+
+    QVERIFY(wm.windows().isEmpty());
+    meter.report();
+}
+
+void WindowsTrackerBenchmark::activeWindowStream_data()
+{
+    sessionsData();
+}
+
+void WindowsTrackerBenchmark::activeWindowStream()
+{
+    QFETCH(int, count);
+    QFETCH(int, screens);
+    QFETCH(int, viewsPerScreen);
+    QFETCH(int, layouts);
+
+    MockWindowInterface wm;
+    const QList<TrackedViewInfo *> views = addViews(wm, screens, viewsPerScreen);
+    const QList<TrackedLayoutInfo *> trackedLayouts = addLayouts(wm, layouts);
+    const QList<WindowId> wids = createWindows(wm, count, screens);
+
+    EventsMeter meter;
+
+    //! every window is activated once per round, e.g. alt+tab through all windows
+    for (int round = 0; round < STREAMROUNDS; ++round) {
+        for (const auto &wid : wids) {
+            meter.record([&]() {
+                wm.activateWindow(wid);
+            });
+        }
+    }
+
+    QCOMPARE(wm.windowsTracker()->infoFor(wm.activeWindow()).isActive(), true);
+    QVERIFY(std::any_of(views.constBegin(), views.constEnd(), [](const TrackedViewInfo *view) {
+        return view->existsWindowActive();
+    }));
+    QVERIFY(trackedLayouts.first()->existsWindowActive());
+
+    meter.report();
+}
+
+void WindowsTrackerBenchmark::moveWindowStream_data()
+{
+    sessionsData();
+}
+
+void WindowsTrackerBenchmark::moveWindowStream()
+{
+    QFETCH(int, count);
+    QFETCH(int, screens);
+    QFETCH(int, viewsPerScreen);
+    QFETCH(int, layouts);
+
+    MockWindowInterface wm;
+    const QList<TrackedViewInfo *> views = addViews(wm, screens, viewsPerScreen);
+    addLayouts(wm, layouts);
+    const QList<WindowId> wids = createWindows(wm, count, screens);
+
+    EventsMeter meter;
+
+    //! windows are dragged one after the other over the bottom dock of their screen,
+    //! every geometry change is sent on its own, e.g. a user moving windows around
+    for (int round = 0; round < STREAMROUNDS; ++round) {
+        for (int i = 0; i < wids.count(); ++i) {
+            const QRect dock = views[(i % screens) * viewsPerScreen]->absoluteGeometry();
+            const QRect geometry = (round % 2 == 0) ? QRect(dock.x(), dock.top() - 200, 320, 240) : windowGeometry(i, screens);
+
+            meter.record([&]() {
+                wm.moveWindow(wids[i], geometry);
+                wm.flushChangedWindows();
+            });
+        }
+    }
+
+    meter.report();
+}
+
+void WindowsTrackerBenchmark::windowsChangedBatch_data()
+{
+    sessionsData();
+}
+
+void WindowsTrackerBenchmark::windowsChangedBatch()
+{
+    QFETCH(int, count);
+    QFETCH(int, screens);
+    QFETCH(int, viewsPerScreen);
+    QFETCH(int, layouts);
+
+    MockWindowInterface wm;
+    const QList<TrackedViewInfo *> views = addViews(wm, screens, viewsPerScreen);
+    addLayouts(wm, layouts);
+    const QList<WindowId> wids = createWindows(wm, count, screens);
+    bool maximized{false};
+
+    EventsMeter meter;
+
+    //! all windows change at once, e.g. a screen or a virtual desktop change,
+    //! the whole batch is one event for the tracker
+    for (int round = 0; round < BATCHROUNDS; ++round) {
+        maximized = !maximized;
+
+        for (const auto &wid : wids) {
+            wm.setMaximized(wid, maximized);
+        }
+
+        meter.record([&]() {
+            wm.flushChangedWindows();
+        });
+    }
+
+    QCOMPARE(wm.windowsTracker()->infoFor(wids.last()).isMaximized(), maximized);
+    QVERIFY(std::all_of(views.constBegin(), views.constEnd(), [maximized](const TrackedViewInfo *view) {
+        return view->existsWindowMaximized() == maximized;
+    }));
+
+    meter.report();
+}
+
+void WindowsTrackerBenchmark::windowsInfoChangedBatch_data()
+{
+    sessionsData();
+}
+
+void WindowsTrackerBenchmark::windowsInfoChangedBatch()
+{
+    QFETCH(int, count);
+    QFETCH(int, screens);
+    QFETCH(int, viewsPerScreen);
+    QFETCH(int, layouts);
+
+    MockWindowInterface wm;
+    addViews(wm, screens, viewsPerScreen);
+    addLayouts(wm, layouts);
+    const QList<WindowId> wids = createWindows(wm, count, screens);
+
+    EventsMeter meter;
+
+    //! changes that do not affect hints, e.g. titles of terminals and browsers
+    for (int round = 1; round <= BATCHROUNDS; ++round) {
+        for (const auto &wid : wids) {
+            wm.renameWindow(wid, QStringLiteral("title %1").arg(round));
+        }
+
+        meter.record([&]() {
+            wm.flushChangedWindows();
+        });
+    }
+
+    QCOMPARE(wm.windowsTracker()->infoFor(wids.last()).display(), QStringLiteral("title %1").arg(BATCHROUNDS));
+    meter.report();
+}
+
+void WindowsTrackerBenchmark::applicationIdentification_data()
+{
+    windowsCountData();
+}
+
+void WindowsTrackerBenchmark::applicationIdentification()
+{
+    QFETCH(int, count);
+
+    MockWindowInterface wm;
+    QSignalSpy spy(wm.windowsTracker(), &Latte::WindowSystem::Tracker::Windows::applicationDataChanged);
+    int round{0};
+
+    //! windows of applications that were never identified, identification and icons
+    //! are resolved in worker threads until every window has reported its data
+    QBENCHMARK {
+        ++round;
+        spy.clear();
+
+        const QList<WindowId> wids = createWindows(wm, count, 1, QStringLiteral("app%1-").arg(round));
+
+        for (const auto &wid : wids) {
+            wm.windowsTracker()->appNameFor(wid);
+        }
+
+        while (spy.count() < count) {
+            QVERIFY2(spy.wait(IDENTIFICATIONTIMEOUT), "applications were not identified in time");
+        }
+
+        for (const auto &wid : wids) {
+            wm.destroyWindow(wid);
+        }
+    }
+}
+
+QTEST_MAIN(WindowsTrackerBenchmark)
+
+#include "windowstrackerbenchmark.moc"
@@ -21,7 +21,7 @@ Ability.AnimationsPrivate {
 
     speedFactor.normal: 1.0
     speedFactor.current: {
-        if (!active || plasmoid.configuration.durationTime === 0) {
+        if (!active || root.renderSuspended || plasmoid.configuration.durationTime === 0) {
             return 0;
         }
 
@@ -898,7 +898,7 @@ Item {
     PlasmaComponents.BusyIndicator {
         z: 1000
         visible: applet && applet.busy
-        running: visible
+        running: visible && !root.renderSuspended
         anchors.centerIn: parent
         width: Math.min(parent.width, parent.height)
         height: width
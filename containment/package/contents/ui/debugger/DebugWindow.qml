@@ -90,6 +90,22 @@ Window{
                 }
             }
 
+            Text{
+                text: "Rendering"+space
+            }
+
+            Text{
+                text: {
+                    if (!latteView || !latteView.renderGovernor) {
+                        return "___";
+                    }
+
+                    var state = latteView.renderGovernor.isSuspended ? "Suspended" : (latteView.renderGovernor.isIdle ? "Idle" : "Active");
+                    return state + " " + latteView.renderGovernor.framesPerSecond + " fps, "
+                            + latteView.renderGovernor.suspendedFrames() + " while suspended";
+                }
+            }
+
             Text{
                 text: "   -----------   "
             }
@@ -55,6 +55,8 @@ Item {
     readonly property bool behaveAsDockWithMask: !behaveAsPlasmaPanel
 
     readonly property bool viewIsAvailable: latteView && latteView.visibility && latteView.effects
+    //! hidden views pause their animations in order to not render any frames
+    readonly property bool renderSuspended: latteView && latteView.renderGovernor ? latteView.renderGovernor.isSuspended : false
 
     property int viewType: {
         if (!latteView || !latteView.visibility) {
@@ -475,9 +475,69 @@ void LayoutManager::restoreOption(const char *option)
     }
 }
 
-bool LayoutManager::isJustifySplitter(const QQuickItem *item) const
+LayoutManager::ItemInfo LayoutManager::itemInfo(QQuickItem *item)
 {
-    return item && (item->property("isInternalViewSplitter").toBool() == true);
+    auto it = m_items.constFind(item);
+
+    if (it != m_items.constEnd()) {
+        return it.value();
+    }
+
+    ItemInfo info;
+
+    if (!item) {
+        return info;
+    }
+
+    if (item->property("isInternalViewSplitter").toBool()) {
+        info.type = ItemInfo::JustifySplitter;
+    } else if (item->property("isParabolicEdgeSpacer").toBool()) {
+        info.type = ItemInfo::ParabolicEdgeSpacer;
+    } else {
+        QObject *applet = item->property("applet").value<QObject *>();
+        int id = applet ? applet->property("id").toInt() : 0;
+
+        if (id > 0) {
+            info.type = ItemInfo::Applet;
+            info.appletId = id;
+        }
+    }
+
+    if (info.type == ItemInfo::Unknown) {
+        //! e.g. dnd spacer or applet containers whose applet is not assigned yet
+        return info;
+    }
+
+    m_items[item] = info;
+
+    if (info.type == ItemInfo::Applet) {
+        m_appletItems[info.appletId] = item;
+    }
+
+    connect(item, &QObject::destroyed, this, [this, item]() {
+        forgetItem(item);
+    });
+
+    return info;
+}
+
+void LayoutManager::forgetItem(QQuickItem *item)
+{
+    ItemInfo info = m_items.take(item);
+
+    if (info.type == ItemInfo::Applet && m_appletItems.value(info.appletId) == item) {
+        m_appletItems.remove(info.appletId);
+    }
+}
+
+bool LayoutManager::isJustifySplitter(QQuickItem *item)
+{
+    return itemInfo(item).type == ItemInfo::JustifySplitter;
+}
+
+bool LayoutManager::isParabolicEdgeSpacer(QQuickItem *item)
+{
+    return itemInfo(item).type == ItemInfo::ParabolicEdgeSpacer;
 }
 
 bool LayoutManager::isMasqueradedIndex(const int &x, const int &y)
@@ -514,30 +574,14 @@ void LayoutManager::save()
 
     reorderParabolicSpacers();
 
-    auto collectLayoutAppletIds = [](QQuickItem *layout, QList<int> &appletIds) {
+    auto collectLayoutAppletIds = [this](QQuickItem *layout, QList<int> &appletIds) {
         int childCount = 0;
-        for (int i=0; i<layout->childItems().count(); ++i) {
-            QQuickItem *item = layout->childItems()[i];
-            bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-            bool isParabolicEdgeSpacer = item->property("isParabolicEdgeSpacer").toBool();
-            if (!isInternalSplitter && !isParabolicEdgeSpacer) {
-                QVariant appletVariant = item->property("applet");
-                if (!appletVariant.isValid()) {
-                    continue;
-                }
-
-                QObject *applet = appletVariant.value<QObject *>();
-
-                if (!applet) {
-                    continue;
-                }
-
-                uint id = applet->property("id").toUInt();
-
-                if (id>0) {
-                    childCount++;
-                    appletIds << id;
-                }
+        const QList<QQuickItem *> items = layout->childItems();
+        for (QQuickItem *item : items) {
+            ItemInfo info = itemInfo(item);
+            if (info.type == ItemInfo::Applet) {
+                childCount++;
+                appletIds << info.appletId;
             }
         }
         return childCount;
@@ -777,27 +821,12 @@ bool LayoutManager::insertAtLayoutCoordinates(QQuickItem *layout, QQuickItem *it
 
 QQuickItem *LayoutManager::firstSplitter()
 {
-    for(int i=0; i<m_startLayout->childItems().count(); ++i) {
-        QQuickItem *item = m_startLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
-        }
-    }
-
-    for(int i=0; i<m_mainLayout->childItems().count(); ++i) {
-        QQuickItem *item = m_mainLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
-        }
-    }
-
-    for(int i=0; i<m_endLayout->childItems().count(); ++i) {
-        QQuickItem *item = m_endLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
+    for (QQuickItem *layout : {m_startLayout, m_mainLayout, m_endLayout}) {
+        const QList<QQuickItem *> items = layout->childItems();
+        for(int i=0; i<items.count(); ++i) {
+            if (isJustifySplitter(items[i])) {
+                return items[i];
+            }
         }
     }
 
@@ -806,27 +835,12 @@ QQuickItem *LayoutManager::firstSplitter()
 
 QQuickItem *LayoutManager::lastSplitter()
 {
-    for(int i=m_endLayout->childItems().count()-1; i>=0; --i) {
-        QQuickItem *item = m_endLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
-        }
-    }
-
-    for(int i=m_mainLayout->childItems().count()-1; i>=0; --i) {
-        QQuickItem *item = m_mainLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
-        }
-    }
-
-    for(int i=m_endLayout->childItems().count()-1; i>=0; --i) {
-        QQuickItem *item = m_endLayout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        if (isInternalSplitter) {
-            return item;
+    for (QQuickItem *layout : {m_endLayout, m_mainLayout, m_startLayout}) {
+        const QList<QQuickItem *> items = layout->childItems();
+        for(int i=items.count()-1; i>=0; --i) {
+            if (isJustifySplitter(items[i])) {
+                return items[i];
+            }
         }
     }
 
@@ -839,27 +853,18 @@ QQuickItem *LayoutManager::appletItemInLayout(QQuickItem *layout, const int &id)
         return nullptr;
     }
 
-    for(int i=0; i<layout->childItems().count(); ++i) {
-        QQuickItem *item = layout->childItems()[i];
-        bool isInternalSplitter = item->property("isInternalViewSplitter").toBool();
-        bool isParabolicEdgeSpacer = item->property("isParabolicEdgeSpacer").toBool();
-        if (!isInternalSplitter && !isParabolicEdgeSpacer) {
-            QVariant appletVariant = item->property("applet");
-            if (!appletVariant.isValid()) {
-                continue;
-            }
-
-            QObject *applet = appletVariant.value<QObject *>();
+    QQuickItem *item = m_appletItems.value(id, nullptr);
 
-            if (!applet) {
-                continue;
-            }
-
-            int tempid = applet->property("id").toInt();
+    if (item) {
+        return item->parentItem() == layout ? item : nullptr;
+    }
 
-            if (id == tempid) {
-                return item;
-            }
+    //! items that have not been registered yet
+    const QList<QQuickItem *> items = layout->childItems();
+    for (QQuickItem *child : items) {
+        ItemInfo info = itemInfo(child);
+        if (info.type == ItemInfo::Applet && info.appletId == id) {
+            return child;
         }
     }
 
@@ -868,7 +873,14 @@ QQuickItem *LayoutManager::appletItemInLayout(QQuickItem *layout, const int &id)
 
 QQuickItem *LayoutManager::appletItem(const int &id)
 {
-    QQuickItem *item = appletItemInLayout(m_mainLayout, id);
+    QQuickItem *item = m_appletItems.value(id, nullptr);
+
+    if (item) {
+        QQuickItem *layout = item->parentItem();
+        return (layout == m_mainLayout || layout == m_startLayout || layout == m_endLayout) ? item : nullptr;
+    }
+
+    item = appletItemInLayout(m_mainLayout, id);
 
     if (!item) {
         item = appletItemInLayout(m_startLayout, id);
@@ -895,9 +907,7 @@ int LayoutManager::dndSpacerIndex()
     if (alignment == Latte::Types::Justify) {
         for(int i=0; i<m_startLayout->childItems().count(); ++i) {
             QQuickItem *item = m_startLayout->childItems()[i];
-            bool isparabolicspacer = item->property("isParabolicEdgeSpacer").toBool();
-
-            if (isparabolicspacer) {
+            if (isParabolicEdgeSpacer(item)) {
                 continue;
             }
 
@@ -910,9 +920,7 @@ int LayoutManager::dndSpacerIndex()
 
     for(int i=0; i<m_mainLayout->childItems().count(); ++i) {
         QQuickItem *item = m_mainLayout->childItems()[i];       
-        bool isparabolicspacer = item->property("isParabolicEdgeSpacer").toBool();
-
-        if (isparabolicspacer) {
+        if (isParabolicEdgeSpacer(item)) {
             continue;
         }
 
@@ -925,9 +933,7 @@ int LayoutManager::dndSpacerIndex()
     if (alignment == Latte::Types::Justify) {
         for(int i=0; i<m_endLayout->childItems().count(); ++i) {
             QQuickItem *item = m_endLayout->childItems()[i];
-            bool isparabolicspacer = item->property("isParabolicEdgeSpacer").toBool();
-
-            if (isparabolicspacer) {
+            if (isParabolicEdgeSpacer(item)) {
                 continue;
             }
 
@@ -1235,37 +1241,14 @@ void LayoutManager::destroyAppletContainer(QObject *applet)
         destroyed = true;
     } else {
         //! when deleted directly for Plasma::Applet destruction e.g. synced applets
-        for (int i=0; i<=2; ++i) {
-            if (destroyed) {
-                break;
-            }
-
-            QQuickItem *layout = (i==0 ? m_startLayout : (i==1 ? m_mainLayout : m_endLayout));
-
-            if (layout->childItems().count() > 0) {
-                int size = layout->childItems().count();
-                for (int j=size-1; j>=0; --j) {
-                    QQuickItem *item = layout->childItems()[j];
-                    bool issplitter = item->property("isInternalViewSplitter").toBool();
-                    if (issplitter) {
-                        continue;
-                    }
-
-                    QVariant appletVariant = item->property("applet");
-                    if (!appletVariant.isValid()) {
-                        continue;
-                    }
-                    PlasmaQuick::AppletQuickItem *appletitem = appletVariant.value<PlasmaQuick::AppletQuickItem *>();
-
-                    if (appletitem && appletitem->applet() == applet) {
-                        item->setVisible(false);
-                        item->setParentItem(m_rootItem);
-                        item->deleteLater();
-                        destroyed = true;
-                        break;
-                    }
-                }
-            }
+        QQuickItem *item = appletItem(id);
+
+        if (item) {
+            item->setVisible(false);
+            item->setParentItem(m_rootItem);
+            item->deleteLater();
+            forgetItem(item);
+            destroyed = true;
         }
     }
 
@@ -1289,9 +1272,8 @@ void LayoutManager::reorderSplitterInStartLayout()
 
         for (int i=0; i<size; ++i) {
             QQuickItem *item = m_startLayout->childItems()[i];
-            bool issplitter = item->property("isInternalViewSplitter").toBool();
 
-            if (issplitter && i<size-1) {
+            if (isJustifySplitter(item) && i<size-1) {
                 splitter = item;
                 break;
             }
@@ -1318,9 +1300,8 @@ void LayoutManager::reorderSplitterInEndLayout()
 
         for (int i=0; i<size; ++i) {
             QQuickItem *item = m_endLayout->childItems()[i];
-            bool issplitter = item->property("isInternalViewSplitter").toBool();
 
-            if (issplitter && i!=0) {
+            if (isJustifySplitter(item) && i!=0) {
                 splitter = item;
                 break;
             }
@@ -1410,8 +1391,7 @@ void LayoutManager::destroyJustifySplitters()
             int size = layout->childItems().count();
             for (int j=size-1; j>=0; --j) {
                 QQuickItem *item = layout->childItems()[j];
-                bool issplitter = item->property("isInternalViewSplitter").toBool();
-                if (issplitter) {
+                if (isJustifySplitter(item)) {
                     item->deleteLater();
                 }
             }
@@ -1476,8 +1456,7 @@ void LayoutManager::moveAppletsBasedOnJustifyAlignment()
     int splitter2{-1};
 
     for(int i=0; i<appletlist.count(); ++i) {
-        bool issplitter = appletlist[i]->property("isInternalViewSplitter").toBool();
-        bool isparabolicspacer = appletlist[i]->property("isParabolicEdgeSpacer").toBool();
+        bool issplitter = isJustifySplitter(appletlist[i]);
 
         if (!firstSplitterFound) {
             insertAtLayoutIndex(m_startLayout, appletlist[i], i);
@@ -1504,8 +1483,8 @@ void LayoutManager::moveAppletsBasedOnJustifyAlignment()
 void LayoutManager::printAppletList(QList<QQuickItem *> list)
 {
     for(int i=0; i<list.count(); ++i) {
-        bool issplitter = list[i]->property("isInternalViewSplitter").toBool();
-        bool isparabolicspacer = list[i]->property("isParabolicEdgeSpacer").toBool();
+        bool issplitter = isJustifySplitter(list[i]);
+        bool isparabolicspacer = isParabolicEdgeSpacer(list[i]);
 
         if (issplitter) {
             qDebug() << i << " __ JUSTIFY SPLITTER";
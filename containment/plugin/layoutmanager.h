@@ -162,7 +162,8 @@ private:
     void reorderSplitterInStartLayout();
     void reorderSplitterInEndLayout();
 
-    bool isJustifySplitter(const QQuickItem *item) const;
+    bool isJustifySplitter(QQuickItem *item);
+    bool isParabolicEdgeSpacer(QQuickItem *item);
     bool isValidApplet(const int &id);
     bool insertAtLayoutCoordinates(QQuickItem *layout, QQuickItem *item, int x, int y);
 
@@ -174,6 +175,23 @@ private:
     QQuickItem *appletItem(const int &id);
     QQuickItem *appletItemInLayout(QQuickItem *layout, const int &id);
 
+    //! typed information about layouts items, it is found once from their
+    //! dynamic properties and it is kept until items are destroyed
+    struct ItemInfo {
+        enum Type {
+            Unknown = 0,
+            Applet,
+            JustifySplitter,
+            ParabolicEdgeSpacer
+        };
+
+        Type type{Unknown};
+        int appletId{-1};
+    };
+
+    ItemInfo itemInfo(QQuickItem *item);
+    void forgetItem(QQuickItem *item);
+
     void printAppletList(QList<QQuickItem *> list);
 
     QList<int> toIntList(const QString &serialized);
@@ -204,6 +222,10 @@ private:
 
     QHash<int, QQuickItem *> m_appletsInScheduledDestruction;
 
+    //! layouts items registry
+    QHash<QQuickItem *, ItemInfo> m_items;
+    QHash<int, QQuickItem *> m_appletItems;
+
     QMetaMethod m_createAppletItemMethod;
     QMetaMethod m_createJustifySplitterMethod;
     QMetaMethod m_initAppletContainerMethod;
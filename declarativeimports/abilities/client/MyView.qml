@@ -48,6 +48,12 @@ AbilityDefinition.MyView {
 
     palette: bridge && bridge.applyPalette ? bridge.palette : theme
 
+    //! tasks model of the applet that is published to its view in order to be reused from cloned views
+    property QtObject tasksModel: null
+    //! tasks model of the original applet when this applet belongs to a cloned view
+    readonly property QtObject sharedTasksModel: isBridgeActive && isReady && ref.myView.sharedTasksModelsRevision >= 0 ?
+                                                     ref.myView.sharedTasksModel(plasmoid.id) : null
+
     readonly property AbilityDefinition.MyView local: AbilityDefinition.MyView {
         isShownFully: true
         inEditMode: plasmoid.userConfiguring
@@ -59,6 +65,9 @@ AbilityDefinition.MyView {
         readonly property Item myView: bridge && bridge.myView ? bridge.myView.host : local
     }
 
+    onIsReadyChanged: publishTasksModel();
+    onTasksModelChanged: publishTasksModel();
+
     //! Bridge - Client assignment
     onIsBridgeActiveChanged: {
         if (isBridgeActive) {
@@ -85,4 +94,10 @@ AbilityDefinition.MyView {
     function action(name) {
         return bridge && ref.myView.isReady ? ref.myView.action(name) : null;
     }
+
+    function publishTasksModel() {
+        if (isBridgeActive && isReady) {
+            ref.myView.setAppletTasksModel(plasmoid.id, tasksModel);
+        }
+    }
 }
@@ -108,6 +108,8 @@ LatteComponents.IndicatorItem{
 
                 roundCorners: true
                 showAttention: indicator.inAttention
+                //! speed is zero when animations are disabled or the view is suspended
+                animationsEnabled: indicator.durationTime > 0
                 showGlow: {
                     if (glowEnabled && (glowApplyTo === 2 /*All*/ || showAttention ))
                         return true;
@@ -12,6 +12,9 @@ AbilityDefinition.MyView {
 
     property QtObject view: null
 
+    //! increased whenever the tasks models that cloned applets can reuse are changed
+    property int sharedTasksModelsRevision: 0
+
     function inCurrentLayout() {
         return view && view.layout && view.layout.isCurrent();
     }
@@ -20,6 +23,21 @@ AbilityDefinition.MyView {
         return view ? view.action(name) : null;
     }
 
+    function sharedTasksModel(appletId) {
+        return view ? view.sharedTasksModel(appletId) : null;
+    }
+
+    function setAppletTasksModel(appletId, model) {
+        if (view && view.extendedInterface) {
+            view.extendedInterface.setAppletTasksModel(appletId, model);
+        }
+    }
+
+    Connections {
+        target: apis.view
+        onSharedTasksModelsChanged: apis.sharedTasksModelsRevision++
+    }
+
     readonly property Item publicApi: Item {
         readonly property alias isReady: apis.isReady
         readonly property alias groupId: apis.groupId
@@ -57,6 +75,8 @@ AbilityDefinition.MyView {
 
         readonly property alias palette: apis.palette
 
+        readonly property alias sharedTasksModelsRevision: apis.sharedTasksModelsRevision
+
         function action(name) {
             return apis.action(name);
         }
@@ -64,5 +84,13 @@ AbilityDefinition.MyView {
         function inCurrentLayout() {
             return apis.inCurrentLayout();
         }
+
+        function sharedTasksModel(appletId) {
+            return apis.sharedTasksModel(appletId);
+        }
+
+        function setAppletTasksModel(appletId, model) {
+            apis.setAppletTasksModel(appletId, model);
+        }
     }
 }
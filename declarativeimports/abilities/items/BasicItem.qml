@@ -96,6 +96,8 @@ Item{
     property Item abilities: null
     property Item contentItem: null
     property Item monochromizedItem: null
+    //! icon source of the contentItem, when it is set item shadows are drawn natively from it
+    property var shadowSource: null
 
     readonly property bool isHorizontal: !isVertical
     readonly property bool isVertical: plasmoid.formFactor === PlasmaCore.Types.Vertical
@@ -124,18 +124,41 @@ Item{
                     && !abilityItem.isSeparator
                     && abilityItem.abilities.environment.isGraphicsSystemAccelerated
 
-            sourceComponent: DropShadow{
-                anchors.fill: parent
-                transformOrigin: abilityItem.iconTransformOrigin
-                opacity: abilityItem.iconOpacity
-                rotation: abilityItem.iconRotation
-                scale: abilityItem.iconScale
-                color: abilityItem.abilities.myView.itemShadow.shadowColor
-                fast: true
-                samples: 2 * radius
-                source: _contentItemContainer
-                radius: abilityItem.abilities.myView.itemShadow.size
-                verticalOffset: 2
+            //! items that provide their icon source use the native shadow that is computed once
+            //! and is batched with the rest item shadows instead of a DropShadow layer per item,
+            //! tinted items keep the DropShadow of their composed content
+            sourceComponent: abilityItem.shadowSource && !abilityItem.isMonochromaticForcedContentItem ? nativeShadowComponent : dropShadowComponent
+
+            Component {
+                id: nativeShadowComponent
+                LatteCore.ItemShadow{
+                    anchors.fill: parent
+                    transformOrigin: abilityItem.iconTransformOrigin
+                    opacity: abilityItem.iconOpacity
+                    rotation: abilityItem.iconRotation
+                    scale: abilityItem.iconScale
+                    color: abilityItem.abilities.myView.itemShadow.shadowColor
+                    source: abilityItem.shadowSource
+                    radius: abilityItem.abilities.myView.itemShadow.size
+                    verticalOffset: 2
+                }
+            }
+
+            Component {
+                id: dropShadowComponent
+                DropShadow{
+                    anchors.fill: parent
+                    transformOrigin: abilityItem.iconTransformOrigin
+                    opacity: abilityItem.iconOpacity
+                    rotation: abilityItem.iconRotation
+                    scale: abilityItem.iconScale
+                    color: abilityItem.abilities.myView.itemShadow.shadowColor
+                    fast: true
+                    samples: 2 * radius
+                    source: _contentItemContainer
+                    radius: abilityItem.abilities.myView.itemShadow.size
+                    verticalOffset: 2
+                }
             }
         }
 
@@ -14,6 +14,7 @@ Item{
     //   property string color
     id: glowItem
 
+    property bool animationsEnabled: true
     property bool glow3D: true
     property bool roundCorners: true
     property bool showBorder: false
@@ -236,7 +237,7 @@ Item{
                 radius: smallCircle.radius
 
                 SequentialAnimation{
-                    running: glowItem.showAttention
+                    running: glowItem.showAttention && glowItem.animationsEnabled
                     loops: Animation.Infinite
                     alwaysRunToEnd: true
 
@@ -15,6 +15,7 @@
 #include "extras.h"
 
 // Qt
+#include <QCache>
 #include <QDebug>
 #include <QPainter>
 #include <QPaintEngine>
@@ -29,8 +30,15 @@
 #include <KIconThemes/KIconLoader>
 #include <KIconThemes/KIconEffect>
 
+#define COMPOSEDPIXMAPSCACHECOST 16*1024*1024
+
 namespace Latte {
 
+namespace {
+//! icons composed with tint and badge masks, shared between all icon items
+QCache<QString, QPixmap> s_composedPixmaps(COMPOSEDPIXMAPSCACHECOST);
+}
+
 IconItem::IconItem(QQuickItem *parent)
     : QQuickItem(parent),
       m_active(false),
@@ -54,6 +62,11 @@ IconItem::IconItem(QQuickItem *parent)
             this, SLOT(schedulePixmapUpdate()));
     connect(this, SIGNAL(providesColorsChanged()),
             this, SLOT(schedulePixmapUpdate()));
+    connect(this, &IconItem::badgeMaskChanged, this, &IconItem::schedulePixmapUpdate);
+    connect(this, &IconItem::tintColorChanged, this, &IconItem::schedulePixmapUpdate);
+    connect(KIconLoader::global(), &KIconLoader::iconLoaderSettingsChanged, this, []() {
+        s_composedPixmaps.clear();
+    });
 
     //initialize implicit size to the Dialog size
     setImplicitWidth(KIconLoader::global()->currentSize(KIconLoader::Dialog));
@@ -416,6 +429,165 @@ void IconItem::setGlowColor(QColor glow)
     emit glowColorChanged();
 }
 
+QColor IconItem::tintColor() const
+{
+    return m_tintColor;
+}
+
+void IconItem::setTintColor(const QColor &color)
+{
+    if (m_tintColor == color) {
+        return;
+    }
+
+    m_tintColor = color;
+    emit tintColorChanged();
+}
+
+bool IconItem::infoBadgeMasked() const
+{
+    return m_infoBadgeMasked;
+}
+
+void IconItem::setInfoBadgeMasked(bool masked)
+{
+    if (m_infoBadgeMasked == masked) {
+        return;
+    }
+
+    m_infoBadgeMasked = masked;
+    emit badgeMaskChanged();
+}
+
+int IconItem::infoBadgeMaskWidth() const
+{
+    return m_infoBadgeMaskWidth;
+}
+
+void IconItem::setInfoBadgeMaskWidth(int width)
+{
+    if (m_infoBadgeMaskWidth == width) {
+        return;
+    }
+
+    m_infoBadgeMaskWidth = width;
+    emit badgeMaskChanged();
+}
+
+bool IconItem::audioBadgeMasked() const
+{
+    return m_audioBadgeMasked;
+}
+
+void IconItem::setAudioBadgeMasked(bool masked)
+{
+    if (m_audioBadgeMasked == masked) {
+        return;
+    }
+
+    m_audioBadgeMasked = masked;
+    emit badgeMaskChanged();
+}
+
+bool IconItem::badgeMaskMirrored() const
+{
+    return m_badgeMaskMirrored;
+}
+
+void IconItem::setBadgeMaskMirrored(bool mirrored)
+{
+    if (m_badgeMaskMirrored == mirrored) {
+        return;
+    }
+
+    m_badgeMaskMirrored = mirrored;
+    emit badgeMaskChanged();
+}
+
+bool IconItem::hasTint() const
+{
+    //! transparent colors are used from qml in order to disable tinting
+    return m_tintColor.isValid() && m_tintColor.alpha() > 0;
+}
+
+bool IconItem::isComposed() const
+{
+    return hasTint() || m_infoBadgeMasked || m_audioBadgeMasked;
+}
+
+QString IconItem::composedPixmapId(const int &size, const qreal &dpr) const
+{
+    QString sourceId;
+
+    if (m_svgIcon) {
+        //! plasma svgs can change with the plasma theme, they are not cached
+        return QString();
+    } else if (!m_icon.isNull()) {
+        sourceId = !m_icon.name().isEmpty() ? QStringLiteral("icon:") + m_icon.name() : QStringLiteral("qicon:") + QString::number(m_icon.cacheKey());
+    } else if (!m_imageIcon.isNull()) {
+        sourceId = QStringLiteral("image:") + QString::number(m_imageIcon.cacheKey());
+    } else {
+        return QString();
+    }
+
+    return sourceId
+            + QLatin1Char('\n') + QString::number(size) + QLatin1Char('@') + QString::number(dpr)
+            + QLatin1Char('\n') + m_overlays.join(QLatin1Char(','))
+            + QLatin1Char('\n') + QString::number(isEnabled()) + QString::number(m_active)
+            + QLatin1Char('\n') + (hasTint() ? m_tintColor.name(QColor::HexArgb) : QString())
+            + QLatin1Char('\n') + QString::number(m_infoBadgeMasked) + QString::number(m_infoBadgeMaskWidth)
+            + QLatin1Char('\n') + QString::number(m_audioBadgeMasked) + QString::number(m_badgeMaskMirrored);
+}
+
+void IconItem::composePixmap(QPixmap &pixmap) const
+{
+    const qreal side = qMin(width(), height());
+
+    if (pixmap.isNull() || side <= 0) {
+        return;
+    }
+
+    QImage image = pixmap.toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+
+    if (hasTint()) {
+        painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+        painter.fillRect(image.rect(), m_tintColor);
+    }
+
+    if (m_infoBadgeMasked || m_audioBadgeMasked) {
+        //! masks are defined in item coordinates
+        painter.scale(image.width() / side, image.height() / side);
+        painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(Qt::black);
+
+        if (m_infoBadgeMasked) {
+            //! rounded badge at the top corner that is not rounded at the icon corner
+            const qreal w = qMax((qreal)m_infoBadgeMaskWidth, side / 2);
+            const qreal h = side / 2;
+            const qreal x = m_badgeMaskMirrored ? 0 : side - w;
+            const qreal radius = qMin(w, h) / 2;
+
+            painter.drawRoundedRect(QRectF(x, 0, w, h), radius, radius);
+            painter.drawRect(QRectF(m_badgeMaskMirrored ? 0 : side - w / 2, 0, w / 2, h / 2));
+        }
+
+        if (m_audioBadgeMasked) {
+            //! circle badge at the opposite top corner
+            const qreal d = side / 2;
+            const qreal x = m_badgeMaskMirrored ? side - d : 0;
+
+            painter.drawEllipse(QRectF(x, 0, d, d));
+            painter.drawRect(QRectF(m_badgeMaskMirrored ? side - d / 2 : 0, 0, d / 2, d / 2));
+        }
+    }
+
+    painter.end();
+    pixmap = QPixmap::fromImage(image);
+}
+
 void IconItem::updateColors()
 {
     QImage icon = m_iconPixmap.toImage();
@@ -476,6 +648,20 @@ void IconItem::loadPixmap()
     //final pixmap to paint
     QPixmap result;
 
+    //! icons with tint or badge masks are composed once for each state
+    QString composedId;
+
+    if (size > 0 && isComposed()) {
+        composedId = composedPixmapId(static_cast<int>(size), (window() ? window()->devicePixelRatio() : qApp->devicePixelRatio()));
+
+        if (!composedId.isEmpty() && s_composedPixmaps.contains(composedId)) {
+            m_iconPixmap = *s_composedPixmaps.object(composedId);
+            m_textureChanged = true;
+            update();
+            return;
+        }
+    }
+
     if (size <= 0) {
         m_iconPixmap = QPixmap();
         update();
@@ -540,6 +726,14 @@ void IconItem::loadPixmap()
         result = KIconLoader::global()->iconEffect()->apply(result, KIconLoader::Desktop, KIconLoader::ActiveState);
     }
 
+    if (isComposed()) {
+        composePixmap(result);
+
+        if (!composedId.isEmpty()) {
+            s_composedPixmaps.insert(composedId, new QPixmap(result), result.width() * result.height() * 4);
+        }
+    }
+
     m_iconPixmap = result;
 
     if (m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId) {
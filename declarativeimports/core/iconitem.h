@@ -99,6 +99,20 @@ class IconItem : public QQuickItem
 
     Q_PROPERTY(QColor backgroundColor READ backgroundColor NOTIFY backgroundColorChanged)
     Q_PROPERTY(QColor glowColor READ glowColor NOTIFY glowColorChanged)
+
+    /**
+     * If valid and not transparent, the icon is painted monochromatic with this color
+     */
+    Q_PROPERTY(QColor tintColor READ tintColor WRITE setTintColor NOTIFY tintColorChanged)
+
+    /**
+     * Badge areas that are cut out from the icon. They are composed together with
+     * the icon into one texture instead of using masking shader effects
+     */
+    Q_PROPERTY(bool infoBadgeMasked READ infoBadgeMasked WRITE setInfoBadgeMasked NOTIFY badgeMaskChanged)
+    Q_PROPERTY(int infoBadgeMaskWidth READ infoBadgeMaskWidth WRITE setInfoBadgeMaskWidth NOTIFY badgeMaskChanged)
+    Q_PROPERTY(bool audioBadgeMasked READ audioBadgeMasked WRITE setAudioBadgeMasked NOTIFY badgeMaskChanged)
+    Q_PROPERTY(bool badgeMaskMirrored READ badgeMaskMirrored WRITE setBadgeMaskMirrored NOTIFY badgeMaskChanged)
 public:
     IconItem(QQuickItem *parent = nullptr);
     virtual ~IconItem();
@@ -135,6 +149,21 @@ public:
 
     QColor glowColor() const;
 
+    QColor tintColor() const;
+    void setTintColor(const QColor &color);
+
+    bool infoBadgeMasked() const;
+    void setInfoBadgeMasked(bool masked);
+
+    int infoBadgeMaskWidth() const;
+    void setInfoBadgeMaskWidth(int width);
+
+    bool audioBadgeMasked() const;
+    void setAudioBadgeMasked(bool masked);
+
+    bool badgeMaskMirrored() const;
+    void setBadgeMaskMirrored(bool mirrored);
+
     void updatePolish() Q_DECL_OVERRIDE;
     QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
 
@@ -146,6 +175,7 @@ public:
 signals:
     void activeChanged();
     void backgroundColorChanged();
+    void badgeMaskChanged();
     void colorGroupChanged();
     void glowColorChanged();
     void lastValidSourceNameChanged();
@@ -154,6 +184,7 @@ signals:
     void providesColorsChanged();
     void smoothChanged();
     void sourceChanged();
+    void tintColorChanged();
     void usesPlasmaThemeChanged();
     void validChanged();
 
@@ -163,6 +194,10 @@ private slots:
 
 private:
     void loadPixmap();
+    void composePixmap(QPixmap &pixmap) const;
+    bool hasTint() const;
+    bool isComposed() const;
+    QString composedPixmapId(const int &size, const qreal &dpr) const;
     void updateColors();
     void setLastLoadedSourceId(QString id);
     void setLastValidSourceName(QString name);
@@ -172,6 +207,9 @@ private:
 private:
     bool m_active;
     bool m_providesColors{false};
+    bool m_infoBadgeMasked{false};
+    bool m_audioBadgeMasked{false};
+    bool m_badgeMaskMirrored{false};
     bool m_smooth;
 
 
@@ -181,6 +219,9 @@ private:
 
     QColor m_backgroundColor;
     QColor m_glowColor;
+    QColor m_tintColor;
+
+    int m_infoBadgeMaskWidth{0};
 
     QIcon m_icon;
     QPixmap m_iconPixmap;
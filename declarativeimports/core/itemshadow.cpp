@@ -0,0 +1,404 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "itemshadow.h"
+
+// C++
+#include <vector>
+
+// Qt
+#include <QCache>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QPixmap>
+#include <QQuickWindow>
+#include <QSharedPointer>
+#include <QWeakPointer>
+#include <QtMath>
+
+// KDE
+#include <KIconThemes/KIconLoader>
+#include <QuickAddons/ManagedTextureNode>
+
+#define SHADOWSIZESTEP 8
+#define SHADOWSCACHECOST 8*1024*1024
+
+namespace Latte {
+
+namespace {
+//! blurred shadows shared between all items, used only from gui thread
+QCache<QString, QImage> s_shadows(SHADOWSCACHECOST);
+
+//! textures of the blurred shadows per window, render threads of different
+//! windows can access them at the same time
+QMutex s_texturesMutex;
+QHash<QString, QWeakPointer<QSGTexture>> s_textures;
+
+QSharedPointer<QSGTexture> shadowTexture(QQuickWindow *window, const QString &key, const QImage &shadow)
+{
+    const QString windowKey = QString::number(reinterpret_cast<quintptr>(window)) + QLatin1Char('\n') + key;
+
+    QMutexLocker locker(&s_texturesMutex);
+
+    QSharedPointer<QSGTexture> texture = s_textures.value(windowKey).toStrongRef();
+
+    if (!texture) {
+        //! atlas textures are what make the shadows of all items batchable
+        texture = QSharedPointer<QSGTexture>(window->createTextureFromImage(shadow, QQuickWindow::TextureCanUseAtlas));
+        s_textures[windowKey] = texture;
+
+        //! drop references of textures that are not used any more
+        for (auto it = s_textures.begin(); it != s_textures.end();) {
+            if (it.value().isNull()) {
+                it = s_textures.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    return texture;
+}
+}
+
+ItemShadow::ItemShadow(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+
+    connect(this, &QQuickItem::windowChanged, this, &ItemShadow::scheduleShadowUpdate);
+    connect(this, &ItemShadow::colorChanged, this, &ItemShadow::scheduleShadowUpdate);
+    connect(this, &ItemShadow::radiusChanged, this, &ItemShadow::scheduleShadowUpdate);
+    connect(this, &ItemShadow::sourceChanged, this, &ItemShadow::scheduleShadowUpdate);
+    connect(this, &ItemShadow::verticalOffsetChanged, this, &QQuickItem::update);
+
+    connect(KIconLoader::global(), &KIconLoader::iconChanged, this, &ItemShadow::onIconsChanged);
+    connect(KIconLoader::global(), &KIconLoader::iconLoaderSettingsChanged, this, &ItemShadow::onIconsChanged);
+}
+
+ItemShadow::~ItemShadow()
+{
+}
+
+QVariant ItemShadow::source() const
+{
+    return m_source;
+}
+
+void ItemShadow::setSource(const QVariant &source)
+{
+    if (m_source == source) {
+        return;
+    }
+
+    m_source = source;
+    m_icon = QIcon();
+    m_image = QImage();
+
+    if (source.canConvert<QIcon>()) {
+        m_icon = source.value<QIcon>();
+    } else if (source.canConvert<QImage>()) {
+        m_image = source.value<QImage>();
+    } else if (source.canConvert<QPixmap>()) {
+        m_image = source.value<QPixmap>().toImage();
+    } else if (source.canConvert<QUrl>() && source.toUrl().isLocalFile()) {
+        m_icon = QIcon(source.toUrl().toLocalFile());
+    } else if (source.canConvert<QString>()) {
+        const QString name = source.toString();
+        m_icon = name.startsWith(QLatin1Char('/')) ? QIcon(name) : QIcon::fromTheme(name);
+    }
+
+    emit sourceChanged();
+}
+
+QColor ItemShadow::color() const
+{
+    return m_color;
+}
+
+void ItemShadow::setColor(const QColor &color)
+{
+    if (m_color == color) {
+        return;
+    }
+
+    m_color = color;
+    emit colorChanged();
+}
+
+int ItemShadow::radius() const
+{
+    return m_radius;
+}
+
+void ItemShadow::setRadius(const int &radius)
+{
+    if (m_radius == radius) {
+        return;
+    }
+
+    m_radius = qMax(0, radius);
+    emit radiusChanged();
+}
+
+int ItemShadow::verticalOffset() const
+{
+    return m_verticalOffset;
+}
+
+void ItemShadow::setVerticalOffset(const int &offset)
+{
+    if (m_verticalOffset == offset) {
+        return;
+    }
+
+    m_verticalOffset = offset;
+    emit verticalOffsetChanged();
+}
+
+void ItemShadow::onIconsChanged()
+{
+    //! named icons are resolved again from the current icon theme
+    const QStringList keys = s_shadows.keys();
+
+    for (const auto &key : keys) {
+        if (key.startsWith(QLatin1String("icon:"))) {
+            s_shadows.remove(key);
+        }
+    }
+
+    if (!m_icon.name().isEmpty()) {
+        m_icon = QIcon::fromTheme(m_icon.name());
+    }
+
+    m_shadowKey.clear();
+    scheduleShadowUpdate();
+}
+
+void ItemShadow::scheduleShadowUpdate()
+{
+    //! a new size must be chosen for the new shadow
+    m_shadowSize = 0;
+    polish();
+}
+
+void ItemShadow::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+
+    if (newGeometry.size() == oldGeometry.size()) {
+        return;
+    }
+
+    const qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
+    const int requested = qCeil(qMin(newGeometry.width(), newGeometry.height()) * dpr);
+
+    //! parabolic zoom only scales the current shadow, a new one is created
+    //! only when the size differs too much from the one it was created for
+    if (m_shadowSize <= 0 || requested > 2 * m_shadowSize || 2 * requested < m_shadowSize) {
+        polish();
+    }
+
+    update();
+}
+
+QString ItemShadow::sourceKey() const
+{
+    if (!m_image.isNull()) {
+        return QStringLiteral("image:") + QString::number(m_image.cacheKey());
+    }
+
+    if (!m_icon.name().isEmpty()) {
+        return QStringLiteral("icon:") + m_icon.name();
+    }
+
+    if (!m_icon.isNull()) {
+        return QStringLiteral("qicon:") + QString::number(m_icon.cacheKey());
+    }
+
+    return QString();
+}
+
+QImage ItemShadow::sourceImage(const int &size) const
+{
+    QImage source = !m_image.isNull() ? m_image : m_icon.pixmap(QSize(size, size)).toImage();
+
+    if (source.isNull()) {
+        return QImage();
+    }
+
+    source = source.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+    //! icons are always centered in a square just like IconItem does
+    QImage centered(size, size, QImage::Format_ARGB32_Premultiplied);
+    centered.fill(Qt::transparent);
+
+    QPainter painter(&centered);
+    painter.drawImage((size - source.width()) / 2, (size - source.height()) / 2, source);
+    painter.end();
+
+    return centered;
+}
+
+void ItemShadow::updatePolish()
+{
+    QQuickItem::updatePolish();
+
+    const QString key = sourceKey();
+
+    if (key.isEmpty() || width() < 1.0 || height() < 1.0) {
+        m_shadowKey.clear();
+        m_shadow = QImage();
+        m_textureChanged = true;
+        update();
+        return;
+    }
+
+    const qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
+    const int requested = qCeil(qMin(width(), height()) * dpr);
+    m_shadowSize = ((requested + SHADOWSIZESTEP - 1) / SHADOWSIZESTEP) * SHADOWSIZESTEP;
+
+    const int radius = qCeil(m_radius * dpr);
+    const QString shadowKey = key + QLatin1Char('\n') + QString::number(m_shadowSize)
+            + QLatin1Char('\n') + QString::number(radius)
+            + QLatin1Char('\n') + m_color.name(QColor::HexArgb);
+
+    if (shadowKey == m_shadowKey) {
+        return;
+    }
+
+    if (!s_shadows.contains(shadowKey)) {
+        QImage shadow = createShadow(sourceImage(m_shadowSize), radius, m_color);
+        s_shadows.insert(shadowKey, new QImage(shadow), shadow.sizeInBytes());
+
+        m_shadow = shadow;
+    } else {
+        m_shadow = *s_shadows.object(shadowKey);
+    }
+
+    m_shadowKey = shadowKey;
+    m_textureChanged = true;
+    update();
+}
+
+QSGNode *ItemShadow::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData)
+
+    if (m_shadow.isNull() || m_shadowSize <= 0 || width() < 1.0 || height() < 1.0) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    ManagedTextureNode *textureNode = dynamic_cast<ManagedTextureNode *>(oldNode);
+
+    if (!textureNode || m_textureChanged) {
+        if (!textureNode) {
+            textureNode = new ManagedTextureNode;
+        }
+
+        textureNode->setTexture(shadowTexture(window(), m_shadowKey, m_shadow));
+        textureNode->setFiltering(QSGTexture::Linear);
+        m_textureChanged = false;
+    }
+
+    //! the shadow image contains the blur margins around the icon
+    const qreal iconSize = qMin(width(), height());
+    const qreal scale = iconSize / m_shadowSize;
+    const qreal margin = (m_shadow.width() - m_shadowSize) * scale / 2;
+
+    const QPointF iconTopLeft = boundingRect().center() - QPointF(iconSize / 2, iconSize / 2);
+    textureNode->setRect(QRectF(iconTopLeft.x() - margin,
+                                iconTopLeft.y() - margin + m_verticalOffset,
+                                iconSize + 2 * margin,
+                                iconSize + 2 * margin));
+
+    return textureNode;
+}
+
+QImage ItemShadow::createShadow(const QImage &source, const int &radius, const QColor &color)
+{
+    if (source.isNull()) {
+        return QImage();
+    }
+
+    const QImage argb = source.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QImage alpha(argb.width() + 2 * radius, argb.height() + 2 * radius, QImage::Format_Alpha8);
+    alpha.fill(0);
+
+    for (int y = 0; y < argb.height(); ++y) {
+        const QRgb *in = reinterpret_cast<const QRgb *>(argb.constScanLine(y));
+        uchar *out = alpha.scanLine(y + radius) + radius;
+
+        for (int x = 0; x < argb.width(); ++x) {
+            out[x] = qAlpha(in[x]);
+        }
+    }
+
+    blurAlpha(alpha, radius);
+
+    QImage shadow(alpha.size(), QImage::Format_ARGB32_Premultiplied);
+
+    for (int y = 0; y < alpha.height(); ++y) {
+        const uchar *in = alpha.constScanLine(y);
+        QRgb *out = reinterpret_cast<QRgb *>(shadow.scanLine(y));
+
+        for (int x = 0; x < alpha.width(); ++x) {
+            const int a = in[x] * color.alpha() / 255;
+            out[x] = qPremultiply(qRgba(color.red(), color.green(), color.blue(), a));
+        }
+    }
+
+    return shadow;
+}
+
+void ItemShadow::blurAlpha(QImage &image, const int &radius)
+{
+    if (radius <= 0) {
+        return;
+    }
+
+    //! three box blur passes per axis approximate the gaussian blur of DropShadow
+    const int box = qMax(1, radius / 2);
+    const int w = image.width();
+    const int h = image.height();
+    std::vector<uchar> line(qMax(w, h));
+
+    auto blurLine = [&line, box](uchar *data, const int &length, const int &stride) {
+        for (int i = 0; i < length; ++i) {
+            line[i] = data[i * stride];
+        }
+
+        int sum = 0;
+        const int window = 2 * box + 1;
+
+        for (int i = -box; i <= box; ++i) {
+            sum += (i >= 0 && i < length) ? line[i] : 0;
+        }
+
+        for (int i = 0; i < length; ++i) {
+            data[i * stride] = static_cast<uchar>(sum / window);
+
+            const int add = i + box + 1;
+            const int remove = i - box;
+            sum += (add < length) ? line[add] : 0;
+            sum -= (remove >= 0) ? line[remove] : 0;
+        }
+    };
+
+    for (int pass = 0; pass < 3; ++pass) {
+        for (int y = 0; y < h; ++y) {
+            blurLine(image.scanLine(y), w, 1);
+        }
+
+        for (int x = 0; x < w; ++x) {
+            blurLine(image.scanLine(0) + x, h, image.bytesPerLine());
+        }
+    }
+}
+
+}
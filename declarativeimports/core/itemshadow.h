@@ -0,0 +1,96 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef ITEMSHADOW_H
+#define ITEMSHADOW_H
+
+// Qt
+#include <QColor>
+#include <QIcon>
+#include <QImage>
+#include <QQuickItem>
+
+namespace Latte {
+
+//! Native shadow for items whose shape is an icon. It replaces DropShadow
+//! that needs an offscreen layer and a gaussian pass per item for every frame.
+//! The blurred shadow is computed once per icon source, size, radius and color,
+//! it is shared between all items and it is only scaled during parabolic zoom.
+//! Shadow textures are placed in the scene graph atlas so the shadows of all
+//! items of a view can be batched into a single draw call.
+class ItemShadow : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * icon that provides the shape of the shadow, it can be an icon name,
+     * QIcon, QImage or QPixmap
+     */
+    Q_PROPERTY(QVariant source READ source WRITE setSource NOTIFY sourceChanged)
+
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+
+    Q_PROPERTY(int radius READ radius WRITE setRadius NOTIFY radiusChanged)
+    Q_PROPERTY(int verticalOffset READ verticalOffset WRITE setVerticalOffset NOTIFY verticalOffsetChanged)
+
+public:
+    ItemShadow(QQuickItem *parent = nullptr);
+    ~ItemShadow() override;
+
+    QVariant source() const;
+    void setSource(const QVariant &source);
+
+    QColor color() const;
+    void setColor(const QColor &color);
+
+    int radius() const;
+    void setRadius(const int &radius);
+
+    int verticalOffset() const;
+    void setVerticalOffset(const int &offset);
+
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+signals:
+    void colorChanged();
+    void radiusChanged();
+    void sourceChanged();
+    void verticalOffsetChanged();
+
+private slots:
+    void onIconsChanged();
+    void scheduleShadowUpdate();
+
+private:
+    QString sourceKey() const;
+    QImage sourceImage(const int &size) const;
+
+    static QImage createShadow(const QImage &source, const int &radius, const QColor &color);
+    static void blurAlpha(QImage &image, const int &radius);
+
+private:
+    bool m_textureChanged{false};
+
+    int m_radius{0};
+    int m_verticalOffset{0};
+    //! size that the shadow image was created for
+    int m_shadowSize{0};
+
+    QColor m_color{Qt::black};
+
+    QIcon m_icon;
+    QImage m_image;
+    QVariant m_source;
+
+    QString m_shadowKey;
+    QImage m_shadow;
+};
+
+}
+
+#endif
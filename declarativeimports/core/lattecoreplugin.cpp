@@ -11,6 +11,7 @@
 #include "dialog.h"
 #include "environment.h"
 #include "iconitem.h"
+#include "itemshadow.h"
 #include "quickwindowsystem.h"
 #include "tools.h"
 
@@ -25,6 +26,7 @@ void LatteCorePlugin::registerTypes(const char *uri)
     Q_ASSERT(uri == QLatin1String("org.kde.latte.core"));
     qmlRegisterUncreatableType<Latte::Types>(uri, 0, 2, "Types", "Latte Types uncreatable");
     qmlRegisterType<Latte::IconItem>(uri, 0, 2, "IconItem");
+    qmlRegisterType<Latte::ItemShadow>(uri, 0, 2, "ItemShadow");
     qmlRegisterType<Latte::Quick::Dialog>(uri, 0, 2, "Dialog");
     qmlRegisterSingletonType<Latte::Environment>(uri, 0, 2, "Environment", &Latte::environment_qobject_singletontype_provider);
     qmlRegisterSingletonType<Latte::Tools>(uri, 0, 2, "Tools", &Latte::tools_qobject_singletontype_provider);
@@ -315,18 +315,25 @@ Item {
         return launch;
     }
 
-    function importLauncherListInModel() {
+    function importLauncherListInModel(model) {
+        //! a tasks model that is not assigned yet can be provided explicitly
+        var targetModel = model ? model : tasksModel;
+
+        if (!targetModel) {
+            return;
+        }
+
         if (bridge && bridge.launchers.host.isReady && !inUniqueGroup()) {
             if (inLayoutGroup()) {
                 console.log("Tasks: Applying LAYOUT Launchers List...");
-                tasksModel.launcherList = bridge.launchers.host.layoutLaunchers;
+                targetModel.launcherList = bridge.launchers.host.layoutLaunchers;
             } else if (inGlobalGroup()) {
                 console.log("Tasks: Applying GLOBAL Launchers List...");
-                tasksModel.launcherList = bridge.launchers.host.universalLaunchers;
+                targetModel.launcherList = bridge.launchers.host.universalLaunchers;
             }
         } else {
             console.log("Tasks: Applying UNIQUE Launchers List...");
-            tasksModel.launcherList = plasmoid.configuration.launchers59;
+            targetModel.launcherList = plasmoid.configuration.launchers59;
         }
     }
 
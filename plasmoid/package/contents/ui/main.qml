@@ -102,10 +102,12 @@ Item {
 
     property color lightTextColor: textColorBrightness > 127.5 ? themeTextColor : themeBackgroundColor
 
-    //a small badgers record (id,value)
+    //a small badgers record (desktop file name -> value)
     //in order to track badgers when there are changes
     //in launcher reference from libtaskmanager
-    property variant badgers:[]
+    property var badgers: ({})
+    //badger id -> task items, in order to update badges without traversing all tasks
+    property var badgerTasks: ({})
     property variant launchersOnActivities: []
 
     //global plasmoid reference to the context menu
@@ -184,7 +186,12 @@ Item {
 
     readonly property int alignment: appletAbilities.containment.alignment
 
-    property alias tasksCount: tasksModel.count
+    property int tasksCount: tasksModel ? tasksModel.count : 0
+
+    //! tasks of cloned views are provided from their original applet tasks model when tasks are not filtered per screen,
+    //! this way clones create only their visual layer
+    readonly property QtObject sharedTasksModel: !showOnlyCurrentScreen ? appletAbilities.myView.sharedTasksModel : null
+    readonly property QtObject tasksModel: sharedTasksModel ? sharedTasksModel : ownTasksModel.object
 
     //END Latte Dock Panel properties
 
@@ -490,66 +497,71 @@ Item {
     /////Window Previews/////////
 
 
-    TaskManager.TasksModel {
-        id: tasksModel
+    Instantiator {
+        id: ownTasksModel
+        active: !root.sharedTasksModel
 
-        virtualDesktop: virtualDesktopInfo.currentDesktop
-        screenGeometry: appletAbilities.myView.screenGeometry
-        // comment in order to support LTS Plasma 5.8
-        // screen: plasmoid.screen
-        activity: appletAbilities.myView.isReady ? appletAbilities.myView.lastUsedActivity : activityInfo.currentActivity
+        delegate: TaskManager.TasksModel {
+            id: _ownTasksModel
 
-        filterByVirtualDesktop: root.showOnlyCurrentDesktop
-        filterByScreen: root.showOnlyCurrentScreen
-        filterByActivity: root.showOnlyCurrentActivity
+            virtualDesktop: virtualDesktopInfo.currentDesktop
+            screenGeometry: appletAbilities.myView.screenGeometry
+            // comment in order to support LTS Plasma 5.8
+            // screen: plasmoid.screen
+            activity: appletAbilities.myView.isReady ? appletAbilities.myView.lastUsedActivity : activityInfo.currentActivity
 
-        launchInPlace: true
-        separateLaunchers: true
-        groupInline: false
+            filterByVirtualDesktop: root.showOnlyCurrentDesktop
+            filterByScreen: root.showOnlyCurrentScreen
+            filterByActivity: root.showOnlyCurrentActivity
 
-        groupMode: groupTasksByDefault ? TaskManager.TasksModel.GroupApplications : TaskManager.TasksModel.GroupDisabled
-        sortMode: TaskManager.TasksModel.SortManual
+            launchInPlace: true
+            separateLaunchers: true
+            groupInline: false
 
-        property bool anyTaskDemandsAttentionInValidTime: false
+            groupMode: groupTasksByDefault ? TaskManager.TasksModel.GroupApplications : TaskManager.TasksModel.GroupDisabled
+            sortMode: TaskManager.TasksModel.SortManual
 
-        onActivityChanged: {
-            ActivitiesTools.currentActivity = String(activity);
-        }
+            property bool anyTaskDemandsAttentionInValidTime: false
 
-        onGroupingAppIdBlacklistChanged: {
-            plasmoid.configuration.groupingAppIdBlacklist = groupingAppIdBlacklist;
-        }
+            onActivityChanged: {
+                ActivitiesTools.currentActivity = String(activity);
+            }
 
-        onGroupingLauncherUrlBlacklistChanged: {
-            plasmoid.configuration.groupingLauncherUrlBlacklist = groupingLauncherUrlBlacklist;
-        }
+            onGroupingAppIdBlacklistChanged: {
+                plasmoid.configuration.groupingAppIdBlacklist = groupingAppIdBlacklist;
+            }
 
-        onAnyTaskDemandsAttentionChanged: {
-            anyTaskDemandsAttentionInValidTime = anyTaskDemandsAttention;
+            onGroupingLauncherUrlBlacklistChanged: {
+                plasmoid.configuration.groupingLauncherUrlBlacklist = groupingLauncherUrlBlacklist;
+            }
 
-            if (anyTaskDemandsAttention){
-                attentionTimer.start();
-            } else {
-                attentionTimer.stop();
+            onAnyTaskDemandsAttentionChanged: {
+                anyTaskDemandsAttentionInValidTime = anyTaskDemandsAttention;
+
+                if (anyTaskDemandsAttention){
+                    attentionTimer.start();
+                } else {
+                    attentionTimer.stop();
+                }
             }
-        }
 
-        Component.onCompleted: {
-            ActivitiesTools.launchersOnActivities = root.launchersOnActivities
-            ActivitiesTools.currentActivity = String(activityInfo.currentActivity);
-            ActivitiesTools.plasmoid = plasmoid;
+            Component.onCompleted: {
+                ActivitiesTools.launchersOnActivities = root.launchersOnActivities
+                ActivitiesTools.currentActivity = String(activityInfo.currentActivity);
+                ActivitiesTools.plasmoid = plasmoid;
 
-            //var loadedLaunchers = ActivitiesTools.restoreLaunchers();
-            ActivitiesTools.importLaunchersToNewArchitecture();
+                //var loadedLaunchers = ActivitiesTools.restoreLaunchers();
+                ActivitiesTools.importLaunchersToNewArchitecture();
 
-            appletAbilities.launchers.importLauncherListInModel();
+                appletAbilities.launchers.importLauncherListInModel(_ownTasksModel);
 
-            groupingAppIdBlacklist = plasmoid.configuration.groupingAppIdBlacklist;
-            groupingLauncherUrlBlacklist = plasmoid.configuration.groupingLauncherUrlBlacklist;
+                groupingAppIdBlacklist = plasmoid.configuration.groupingAppIdBlacklist;
+                groupingLauncherUrlBlacklist = plasmoid.configuration.groupingLauncherUrlBlacklist;
 
-            ///Plasma 5.9 enforce grouping at all cases
-            if (LatteCore.Environment.plasmaDesktopVersion >= LatteCore.Environment.makeVersion(5,9,0)) {
-                groupingWindowTasksThreshold = -1;
+                ///Plasma 5.9 enforce grouping at all cases
+                if (LatteCore.Environment.plasmaDesktopVersion >= LatteCore.Environment.makeVersion(5,9,0)) {
+                    groupingWindowTasksThreshold = -1;
+                }
             }
         }
     }
@@ -711,6 +723,8 @@ Item {
         layout: icList.contentItem
         tasksModel: tasksModel
 
+        myView.tasksModel: ownTasksModel.object
+
         animations.local.speedFactor.current: plasmoid.configuration.durationTime
         animations.local.requirements.zoomFactor: hasHighThicknessAnimation && LatteCore.WindowSystem.compositingActive ? 1.65 : 1.0
 
@@ -986,7 +1000,7 @@ Item {
                     property int currentSpot : -1000
                     property int previousCount : 0
 
-                    property int tasksCount: tasksModel.count
+                    property int tasksCount: tasksModel ? tasksModel.count : 0
 
                     //the duration of this animation should be as small as possible
                     //it fixes a small issue with the dragging an item to change it's
@@ -1206,34 +1220,60 @@ Item {
         appletAbilities.shortcuts.sglNewInstanceForEntryAtIndex(index);
     }
 
-    function getBadger(identifier) {
-        var ident1 = identifier;
-        var n = ident1.lastIndexOf('/');
+    function badgerId(identifier) {
+        //! launcher urls may carry a query, e.g. applications:org.kde.dolphin.desktop?iconData=...
+        var queryStarts = identifier.indexOf('?');
+        var path = queryStarts>=0 ? identifier.substring(0, queryStarts) : identifier;
+        var n = Math.max(path.lastIndexOf('/'), path.lastIndexOf(':'));
+        return n>=0 ? path.substring(n + 1) : path;
+    }
 
-        var result = n>=0 ? ident1.substring(n + 1) : identifier;
+    function registerBadgerTask(id, task) {
+        if (!badgerTasks.hasOwnProperty(id)) {
+            badgerTasks[id] = [];
+        }
 
-        for(var i=0; i<badgers.length; ++i) {
-            if (result.indexOf(badgers[i].id) >= 0) {
-                return badgers[i];
-            }
+        if (badgerTasks[id].indexOf(task) < 0) {
+            badgerTasks[id].push(task);
         }
     }
 
+    function unregisterBadgerTask(id, task) {
+        if (!badgerTasks.hasOwnProperty(id)) {
+            return;
+        }
+
+        var pos = badgerTasks[id].indexOf(task);
+
+        if (pos >= 0) {
+            badgerTasks[id].splice(pos, 1);
+        }
+
+        if (badgerTasks[id].length === 0) {
+            delete badgerTasks[id];
+        }
+    }
+
+    function getBadger(identifier) {
+        var id = badgerId(identifier);
+        return badgers.hasOwnProperty(id) ? {id: id, value: badgers[id]} : undefined;
+    }
+
     function updateBadge(identifier, value) {
-        var tasks = icList.contentItem.children;
         var identifierF = identifier.concat(".desktop");
+        var tasks = badgerTasks.hasOwnProperty(identifierF) ? badgerTasks[identifierF] : [];
+
+        if (value === "") {
+            delete badgers[identifierF];
+        } else {
+            badgers[identifierF] = value;
+        }
 
         for(var i=0; i<tasks.length; ++i){
             var task = tasks[i];
 
-            if (task && task.launcherUrl && task.launcherUrl.indexOf(identifierF) >= 0) {
+            if (task) {
                 task.badgeIndicator = value === "" ? 0 : Number(value);
-                var badge = getBadger(identifierF);
-                if (badge) {
-                    badge.value = value;
-                } else {
-                    badgers.push({id: identifierF, value: value});
-                }
             }
         }
     }
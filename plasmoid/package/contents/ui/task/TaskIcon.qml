@@ -32,6 +32,9 @@ Item {
     readonly property QtObject smartLauncherItem: smartLauncherLoader.active ? smartLauncherLoader.item : null
 
     readonly property Item monochromizedItem: badgesLoader.active ? badgesLoader.item : taskIconItem
+    readonly property var iconSource: taskIconItem.source
+    //! badges and their masks change the shape of the icon graphic
+    readonly property bool hasOverlays: badgesLoader.active || badgeVisualsLoader.active
 
     Rectangle{
         id: draggedRectangle
@@ -151,143 +154,20 @@ Item {
             NumberAnimation { duration: 2 * taskItem.abilities.animations.speedFactor.current * taskItem.abilities.animations.duration.large }
         }
 
-        sourceComponent: Item{
-            ShaderEffect {
-                id: iconOverlay
-                enabled: false
-                anchors.fill: parent
-                property var source: ShaderEffectSource {
-                    sourceItem: Kirigami.Icon{
-                        width: taskIconItem.width
-                        height: taskIconItem.height
-                        smooth: taskIconItem.smooth
-                        source: taskIconItem.source
-                        //roundToIconSize: taskIconItem.roundToIconSize
-                        active: taskIconItem.active
-
-                        Loader{
-                            anchors.fill: parent
-                            active: plasmoid.configuration.forceMonochromaticIcons
-
-                            sourceComponent: ColorOverlay {
-                                anchors.fill: parent
-                                color: latteBridge ? latteBridge.palette.textColor : "transparent"
-                                source: taskIconItem
-                            }
-                        }
-                    }
-                }
-                property var mask: ShaderEffectSource {
-                    sourceItem: Item{
-                        LayoutMirroring.enabled: Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical
-                        LayoutMirroring.childrenInherit: true
-
-                        width: taskIconContainer.width
-                        height: taskIconContainer.height
-
-                        Rectangle{
-                            id: maskRect
-                            width: Math.max(badgeVisualsLoader.infoBadgeWidth, parent.width / 2)
-                            height: parent.height / 2
-                            radius: parent.height
-                            visible: badgesLoader.showInfo || badgesLoader.showProgress
-
-                            //! Removes any remainings from the icon around the roundness at the corner
-                            Rectangle{
-                                id: maskCorner
-                                width: parent.width/2
-                                height: parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                }
-                            ]
-                        } // progressMask
-
-                        Rectangle{
-                            id: maskRect2
-                            width: parent.width/2
-                            height: width
-                            radius: width
-                            visible: badgesLoader.showAudio
-
-                            Rectangle{
-                                id: maskCorner2
-                                width:parent.width/2
-                                height:parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                }
-                            ]
-                        } // audio mask
-                    }
-                    hideSource: true
-                    live: true
-                } //end of mask
-
-                supportsAtlasTextures: true
-
-                fragmentShader: "
-        varying highp vec2 qt_TexCoord0;
-        uniform highp float qt_Opacity;
-        uniform lowp sampler2D source;
-        uniform lowp sampler2D mask;
-        void main() {
-            gl_FragColor = texture2D(source, qt_TexCoord0.st) * (1.0 - (texture2D(mask, qt_TexCoord0.st).a)) * qt_Opacity;
-        }
-    "
-            } //end of sourceComponent
+        //! icon, monochrome tint and badge masks are composed natively into one texture
+        sourceComponent: LatteCore.IconItem{
+            anchors.fill: parent
+            smooth: taskIconItem.smooth
+            source: taskIconItem.source
+            active: taskIconItem.active
+
+            tintColor: plasmoid.configuration.forceMonochromaticIcons && latteBridge ? latteBridge.palette.textColor : "transparent"
+
+            infoBadgeMasked: badgesLoader.showInfo || badgesLoader.showProgress
+            infoBadgeMaskWidth: badgeVisualsLoader.infoBadgeWidth
+            audioBadgeMasked: badgesLoader.showAudio
+            badgeMaskMirrored: (root.location === PlasmaCore.Types.RightEdge)
+                               !== (Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical)
         }
     }
     ////!
@@ -127,6 +127,7 @@ AbilityItem.BasicItem {
     property string modelLauncherUrl: (LauncherUrlWithoutIcon && LauncherUrlWithoutIcon !== null) ? LauncherUrlWithoutIcon : ""
     property string modelLauncherUrlWithIcon: (LauncherUrl && LauncherUrl !== null) ? LauncherUrl : ""
     property string launcherUrl: ""
+    property string registeredBadgerId: ""
     property string launcherUrlWithIcon: ""
     property string launcherName: ""
 
@@ -242,6 +243,7 @@ AbilityItem.BasicItem {
     contentItem: TaskIcon{
         id:taskIcon
     }
+    shadowSource: !taskIcon.hasOverlays ? taskIcon.iconSource : null
     //////
 
     property QtObject contextMenu: null
@@ -361,7 +363,10 @@ AbilityItem.BasicItem {
         }
     }
 
-    onLauncherUrlChanged: updateBadge();
+    onLauncherUrlChanged: {
+        updateBadgerRegistration();
+        updateBadge();
+    }
 
     onShortcutRequestedActivate: {
         if (taskItem.isGroupParent) {
@@ -806,6 +811,24 @@ AbilityItem.BasicItem {
         taskItem.audioStreams.forEach(function (item) { item.decreaseVolume(); });
     }
 
+    function updateBadgerRegistration() {
+        var id = launcherUrl !== "" ? root.badgerId(launcherUrl) : "";
+
+        if (id === registeredBadgerId) {
+            return;
+        }
+
+        if (registeredBadgerId !== "") {
+            root.unregisterBadgerTask(registeredBadgerId, taskItem);
+        }
+
+        registeredBadgerId = id;
+
+        if (id !== "") {
+            root.registerBadgerTask(id, taskItem);
+        }
+    }
+
     function updateBadge() {
         var badger = root.getBadger(launcherUrl);
 
@@ -926,6 +949,10 @@ AbilityItem.BasicItem {
 
         tasksExtendedManager.waitingLauncherRemoved.disconnect(slotWaitingLauncherRemoved);
 
+        if (registeredBadgerId !== "") {
+            root.unregisterBadgerTask(registeredBadgerId, taskItem);
+        }
+
         taskItem.parabolicItem.sendEndOfNeedBothAxisAnimation();
     }
 